@@ -1,3 +1,5 @@
+#ifndef ALLOCATOR_HPP
+#define ALLOCATOR_HPP
 #include <cstddef>
 #include <new>
 
@@ -25,31 +27,41 @@ class allocator{
         allocator& operator=(const allocator<T>& a) = default;
         allocator& operator=(allocator<T>&& a) = default;
 
+        template<typename U>
+        allocator(const allocator<U>&) noexcept{}
+
         pointer address(reference r) const noexcept{
-            return &x;
+            return &r;
         }
 
         const_pointer address(const_reference r) const noexcept{
-            return &x;
+            return &r;
         }
 
         
-        pointer allocate(size_type n, const_pointer hint = 0) {
+        pointer allocate(size_type n, const_pointer = 0) {
+            if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__){
+                return static_cast<pointer>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+            }
             return static_cast<pointer>(::operator new(n * sizeof(T)));
         }
 
         // deallocate
-        void deallocate(pointer p, size_type n) {
-            ::operator delete(p);
+        void deallocate(pointer p, size_type) {
+            if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(p, std::align_val_t(alignof(T)));
+            else ::operator delete(p);
         }
 
        
-        bool operator==(const MyAllocator&) const noexcept {
+        template<typename U>
+        bool operator==(const allocator<U>&) const noexcept {
             return true;
         }
 
-        bool operator!=(const MyAllocator& other) const noexcept {
+        template<typename U>
+        bool operator!=(const allocator<U>& other) const noexcept {
             return !(*this == other);
         }
-};  
-        
\ No newline at end of file
+};
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef HUGE_PAGE_ALLOCATOR_CPP
+#define HUGE_PAGE_ALLOCATOR_CPP
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sys/mman.h>
+#include "huge_page_allocator.hpp"
+
+/*
+    @file huge_page_allocator.cpp
+    @brief The current cpp source file contains the actual implementation of the huge_page_allocator class.
+    Definitions are given in this file since it is a template class.
+*/
+
+/**
+ * @brief Constructor.
+ *
+ * @param mode Whether to rely on transparent huge pages or to request reserved (hugetlbfs) pages.
+ * @param prefault Whether to fault every page in when it is mapped.
+ * @param threshold The smallest request, in bytes, served by a mapping.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+huge_page_allocator<T>::huge_page_allocator(huge_page_mode mode, bool prefault, size_t threshold) noexcept : mode(mode), prefault(prefault), threshold(threshold){};
+
+template<typename T>
+template<typename U>
+huge_page_allocator<T>::huge_page_allocator(const huge_page_allocator<U>& a) noexcept : mode(a.get_mode()), prefault(a.get_prefault()), threshold(a.get_threshold()){};
+
+/**
+ * @brief Allocates storage for n objects of type T.
+ *
+ * @param n The number of objects.
+ * @return A pointer to the uninitialized storage, 2 MiB aligned if it is mapped.
+ * @throws std::bad_alloc If the mapping fails.
+ *
+ * @note the time complexity is O(1), O(n) with prefaulting
+ */
+template<typename T>
+typename huge_page_allocator<T>::pointer huge_page_allocator<T>::allocate(size_type n, const_pointer){
+    const size_t bytes = bytes_of(n);
+    if(mapped(bytes)) return static_cast<pointer>(map(mapping_length(bytes)));
+
+    if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) return static_cast<pointer>(::operator new(bytes, std::align_val_t(alignof(T))));
+    else return static_cast<pointer>(::operator new(bytes));
+};
+
+/**
+ * @brief Frees storage obtained from allocate(n) or reallocate(..., n).
+ *
+ * @note the time complexity is O(1) plus the unmapping
+ */
+template<typename T>
+void huge_page_allocator<T>::deallocate(pointer p, size_type n){
+    if(!p) return;
+
+    const size_t bytes = bytes_of(n);
+    if(mapped(bytes)){
+        munmap(p, mapping_length(bytes));
+        return;
+    }
+
+    if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(p, std::align_val_t(alignof(T)));
+    else ::operator delete(p);
+};
+
+/**
+ * @brief Resizes storage holding trivially copyable objects, keeping the first min(old_n, new_n) of them.
+ *
+ * When both sizes are mapped the mapping is resized with mremap, which never copies the data; otherwise, or if
+ * mremap fails, new storage is allocated and the data copied.
+ *
+ * @param p The storage, obtained for old_n objects.
+ * @param old_n The current number of objects.
+ * @param new_n The new number of objects.
+ * @return The resized storage, which may have moved.
+ *
+ * @note the time complexity is O(new_n - old_n) page table updates when remapped, O(min(old_n, new_n)) when copied
+ */
+template<typename T>
+typename huge_page_allocator<T>::pointer huge_page_allocator<T>::reallocate(pointer p, size_type old_n, size_type new_n){
+    static_assert(std::is_trivially_copyable<T>::value, "reallocate requires a trivially copyable T");
+    const size_t old_bytes = bytes_of(old_n);
+    const size_t new_bytes = bytes_of(new_n);
+
+    if(p && mapped(old_bytes) && mapped(new_bytes)){
+        const size_t old_length = mapping_length(old_bytes);
+        const size_t new_length = mapping_length(new_bytes);
+        if(old_length == new_length) return p;
+
+        void* q = mremap(p, old_length, new_length, MREMAP_MAYMOVE);
+        if(q != MAP_FAILED){
+            if(new_length > old_length) prepare(static_cast<char*>(q) + old_length, new_length - old_length);
+            return static_cast<pointer>(q);
+        }
+    }
+
+    pointer q = allocate(new_n);
+    if(p){
+        std::memcpy(q, p, std::min(old_bytes, new_bytes));
+        deallocate(p, old_n);
+    }
+    return q;
+};
+
+template<typename T>
+huge_page_mode huge_page_allocator<T>::get_mode() const noexcept{
+    return mode;
+};
+
+template<typename T>
+bool huge_page_allocator<T>::get_prefault() const noexcept{
+    return prefault;
+};
+
+template<typename T>
+size_t huge_page_allocator<T>::get_threshold() const noexcept{
+    return threshold;
+};
+
+template<typename T>
+size_t huge_page_allocator<T>::bytes_of(size_type n){
+    if(n > std::numeric_limits<size_type>::max() / sizeof(T)) throw std::bad_array_new_length();
+    return n * sizeof(T);
+};
+
+template<typename T>
+size_t huge_page_allocator<T>::mapping_length(size_t bytes){
+    return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+};
+
+template<typename T>
+bool huge_page_allocator<T>::mapped(size_t bytes) const{
+    return bytes != 0 && bytes >= threshold;
+};
+
+/**
+ * @brief Maps length bytes (a multiple of huge_page_size) of zeroed memory aligned to huge_page_size.
+ *
+ * The transparent mapping over-maps by one huge page and trims both ends, since mmap only aligns to 4 KiB pages.
+ */
+template<typename T>
+void* huge_page_allocator<T>::map(size_t length) const{
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+    if(mode == huge_page_mode::explicit_pages){
+        void* p = mmap(nullptr, length, prot, flags | MAP_HUGETLB | (prefault ? MAP_POPULATE : 0), -1, 0);
+        if(p != MAP_FAILED) return p;
+    }
+#endif
+
+    const size_t span = length + huge_page_size;
+    void* raw = mmap(nullptr, span, prot, flags, -1, 0);
+    if(raw == MAP_FAILED) throw std::bad_alloc();
+
+    char* begin = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(begin) + huge_page_size - 1) & ~uintptr_t(huge_page_size - 1));
+    const size_t head = aligned - begin;
+    if(head) munmap(begin, head);
+    if(span - head - length) munmap(aligned + length, span - head - length);
+
+    prepare(aligned, length);
+    return aligned;
+};
+
+/**
+ * @brief Advises [p, p + length) for transparent huge pages and, if requested, faults it in.
+ */
+template<typename T>
+void huge_page_allocator<T>::prepare(char* p, size_t length) const{
+#ifdef MADV_HUGEPAGE
+    madvise(p, length, MADV_HUGEPAGE);
+#endif
+    if(!prefault) return;
+    for(size_t i = 0; i < length; i += 4096) static_cast<volatile char*>(p)[i] = 0;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef HUGE_PAGE_ALLOCATOR_HPP
+#define HUGE_PAGE_ALLOCATOR_HPP
+#include <cstddef>
+#include <new>
+
+/**
+ * @file huge_page_allocator.hpp
+ * @brief An allocator backing large requests with anonymous mappings on huge pages.
+ *
+ * Requests of at least threshold bytes are mapped directly with mmap, rounded to 2 MiB and aligned to 2 MiB. In
+ * transparent mode the mapping is advised with MADV_HUGEPAGE, in explicit mode it is requested with MAP_HUGETLB and
+ * falls back to the transparent mapping when no huge page is reserved. reallocate grows a mapping with mremap, which
+ * moves page table entries instead of copying the data. Optionally every page is faulted in up front, so that scans
+ * do not pay page faults. Smaller requests go to ::operator new.
+ *
+ * Containers use reallocate when their elements are trivially copyable, e.g. vector<double, huge_page_allocator<double>>.
+ *
+ * @author Andrea Maggetto
+ */
+
+enum class huge_page_mode{
+    transparent,
+    explicit_pages
+};
+
+template<typename T>
+class huge_page_allocator{
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using const_pointer = const T*;
+        using const_reference = const T&;
+        using size_type = size_t;
+
+        static constexpr size_t huge_page_size = size_t(2) << 20;
+
+        template<typename U>
+        struct rebind{
+            using other = huge_page_allocator<U>;
+        };
+
+        explicit huge_page_allocator(huge_page_mode mode = huge_page_mode::transparent, bool prefault = false, size_t threshold = huge_page_size) noexcept;
+        ~huge_page_allocator() = default;
+
+        huge_page_allocator(const huge_page_allocator<T>& a) noexcept = default;
+        huge_page_allocator(huge_page_allocator<T>&& a) noexcept = default;
+
+        huge_page_allocator& operator=(const huge_page_allocator<T>& a) = default;
+        huge_page_allocator& operator=(huge_page_allocator<T>&& a) = default;
+
+        template<typename U>
+        huge_page_allocator(const huge_page_allocator<U>& a) noexcept;
+
+        pointer address(reference r) const noexcept{
+            return &r;
+        }
+
+        const_pointer address(const_reference r) const noexcept{
+            return &r;
+        }
+
+        pointer allocate(size_type n, const_pointer = 0);
+        void deallocate(pointer p, size_type n);
+        pointer reallocate(pointer p, size_type old_n, size_type new_n);
+
+        huge_page_mode get_mode() const noexcept;
+        bool get_prefault() const noexcept;
+        size_t get_threshold() const noexcept;
+
+        template<typename U>
+        bool operator==(const huge_page_allocator<U>& other) const noexcept{
+            return threshold == other.get_threshold();
+        }
+
+        template<typename U>
+        bool operator!=(const huge_page_allocator<U>& other) const noexcept{
+            return !(*this == other);
+        }
+
+    private:
+        huge_page_mode mode;
+        bool prefault;
+        size_t threshold;
+
+        static size_t bytes_of(size_type n);
+        static size_t mapping_length(size_t bytes);
+        bool mapped(size_t bytes) const;
+        void* map(size_t length) const;
+        void prepare(char* p, size_t length) const;
+};
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef THREAD_CACHE_ALLOCATOR_CPP
+#define THREAD_CACHE_ALLOCATOR_CPP
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include "thread_cache_allocator.hpp"
+
+/*
+    @file thread_cache_allocator.cpp
+    @brief The current cpp source file contains the actual implementation of thread_cache_heap and thread_cache_allocator.
+    The heap definitions are inline since the file is included wherever the allocator is used.
+*/
+
+/**
+ * @class central
+ * @brief The shared heap: per size class, full batches returned by the caches, loose blocks, and the span being carved.
+ *
+ * Spans are taken from ::operator new and never given back, since their blocks keep circulating through the caches.
+ */
+class thread_cache_heap::central{
+    central_list lists[classes];
+    std::mutex spans_mtx_;
+    void* spans = nullptr;
+
+    char* new_span(){
+        void* s = ::operator new(span_bytes);
+        std::lock_guard<std::mutex> lock(spans_mtx_);
+        *static_cast<void**>(s) = spans;
+        spans = s;
+        return static_cast<char*>(s) + 16;
+    }
+
+    block* carve(central_list& cl, size_t size){
+        if(cl.span_left < size){
+            cl.span = new_span();
+            cl.span_left = span_bytes - 16;
+        }
+        block* b = reinterpret_cast<block*>(cl.span);
+        cl.span += size;
+        cl.span_left -= size;
+        return b;
+    }
+
+    public:
+        /**
+         * @brief Fills the empty free list fl with one batch of class c.
+         */
+        void take(size_t c, free_list& fl){
+            central_list& cl = lists[c];
+            const size_t n = batch_size(c);
+            std::lock_guard<std::mutex> lock(cl.mtx_);
+
+            if(cl.batches){
+                fl.head = cl.batches;
+                fl.count = n;
+                cl.batches = cl.batches->next_batch;
+                return;
+            }
+            block* head = nullptr;
+            size_t count = 0;
+            for(; count < n && cl.loose; ++count){
+                block* b = cl.loose;
+                cl.loose = b->next;
+                b->next = head;
+                head = b;
+            }
+            for(; count < n; ++count){
+                block* b = carve(cl, class_size(c));
+                b->next = head;
+                head = b;
+            }
+            fl.head = head;
+            fl.count = n;
+        }
+
+        /**
+         * @brief Takes back a chain of exactly batch_size(c) blocks.
+         */
+        void give(size_t c, block* batch){
+            central_list& cl = lists[c];
+            std::lock_guard<std::mutex> lock(cl.mtx_);
+            batch->next_batch = cl.batches;
+            cl.batches = batch;
+        }
+
+        /**
+         * @brief Takes back a chain of any length, e.g. the content of the cache of an exiting thread.
+         */
+        void give_loose(size_t c, block* head){
+            if(!head) return;
+            block* last = head;
+            while(last->next) last = last->next;
+
+            central_list& cl = lists[c];
+            std::lock_guard<std::mutex> lock(cl.mtx_);
+            last->next = cl.loose;
+            cl.loose = head;
+        }
+
+        void* take_one(size_t c){
+            free_list fl;
+            take(c, fl);
+            block* b = fl.head;
+            give_loose(c, b->next);
+            return b;
+        }
+
+        void give_one(size_t c, void* p){
+            block* b = static_cast<block*>(p);
+            b->next = nullptr;
+            give_loose(c, b);
+        }
+};
+
+/**
+ * @class cache
+ * @brief The free lists of one thread, flushed to the central heap when the thread exits.
+ */
+class thread_cache_heap::cache{
+    public:
+        free_list lists[classes];
+
+        ~cache(){
+            for(size_t c = 0; c < classes; ++c) central_heap().give_loose(c, lists[c].head);
+            cache_dead = true;
+        }
+};
+
+/**
+ * @brief Returns the size class serving requests of the given size: multiples of 16 up to 256, then powers of two.
+ */
+inline size_t thread_cache_heap::class_of(size_t bytes){
+    if(bytes <= 256) return bytes == 0 ? 0 : (bytes + 15) / 16 - 1;
+    return 16 + std::bit_width(bytes - 1) - 9;
+};
+
+inline size_t thread_cache_heap::class_size(size_t c){
+    return c < 16 ? (c + 1) * 16 : size_t(512) << (c - 16);
+};
+
+/**
+ * @brief Returns the number of blocks moved at once between a cache and the central heap.
+ */
+inline size_t thread_cache_heap::batch_size(size_t c){
+    return std::clamp<size_t>(32768 / class_size(c), 2, 64);
+};
+
+/**
+ * @brief Returns the central heap, created on first use and never destroyed, so that it outlives every cache.
+ */
+inline thread_cache_heap::central& thread_cache_heap::central_heap(){
+    static central* heap = new central;
+    return *heap;
+};
+
+/**
+ * @brief Returns the cache of the calling thread, or nullptr while the thread is exiting and its cache is gone.
+ */
+inline thread_cache_heap::cache* thread_cache_heap::local_cache(){
+    if(cache_dead) return nullptr;
+    static thread_local cache tc;
+    return &tc;
+};
+
+/**
+ * @brief Allocates bytes bytes aligned to 16.
+ *
+ * @note the time complexity is O(1) amortized, lock-free unless a batch has to be fetched from the central heap
+ */
+inline void* thread_cache_heap::allocate(size_t bytes){
+    if(bytes > max_small) return ::operator new(bytes);
+
+    const size_t c = class_of(bytes);
+    cache* tc = local_cache();
+    if(!tc) return central_heap().take_one(c);
+
+    free_list& fl = tc->lists[c];
+    if(!fl.head) central_heap().take(c, fl);
+    block* b = fl.head;
+    fl.head = b->next;
+    --fl.count;
+    return b;
+};
+
+/**
+ * @brief Frees p, allocated with the same bytes by any thread.
+ *
+ * @note the time complexity is O(1) amortized, lock-free unless a batch has to be returned to the central heap
+ */
+inline void thread_cache_heap::deallocate(void* p, size_t bytes){
+    if(!p) return;
+    if(bytes > max_small){
+        ::operator delete(p);
+        return;
+    }
+
+    const size_t c = class_of(bytes);
+    cache* tc = local_cache();
+    if(!tc){
+        central_heap().give_one(c, p);
+        return;
+    }
+
+    free_list& fl = tc->lists[c];
+    block* b = static_cast<block*>(p);
+    b->next = fl.head;
+    fl.head = b;
+    const size_t n = batch_size(c);
+    if(++fl.count < 2 * n) return;
+
+    block* last = fl.head;
+    for(size_t i = 1; i < n; ++i) last = last->next;
+    block* batch = fl.head;
+    fl.head = last->next;
+    last->next = nullptr;
+    fl.count -= n;
+    central_heap().give(c, batch);
+};
+
+/**
+ * @brief Allocates storage for n objects of type T.
+ *
+ * @param n The number of objects.
+ * @return A pointer to the uninitialized storage.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+typename thread_cache_allocator<T>::pointer thread_cache_allocator<T>::allocate(size_type n, const_pointer){
+    if(n > std::numeric_limits<size_type>::max() / sizeof(T)) throw std::bad_array_new_length();
+    if constexpr(alignof(T) > 16) return static_cast<pointer>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    else return static_cast<pointer>(thread_cache_heap::allocate(n * sizeof(T)));
+};
+
+/**
+ * @brief Frees storage obtained from allocate(n) by any thread.
+ *
+ * @param p The storage.
+ * @param n The number of objects passed to allocate.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+void thread_cache_allocator<T>::deallocate(pointer p, size_type n){
+    if constexpr(alignof(T) > 16) ::operator delete(p, std::align_val_t(alignof(T)));
+    else thread_cache_heap::deallocate(p, n * sizeof(T));
+};
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef THREAD_CACHE_ALLOCATOR_HPP
+#define THREAD_CACHE_ALLOCATOR_HPP
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+/**
+ * @file thread_cache_allocator.hpp
+ * @brief A thread-caching allocator, usable as the Alloc parameter of the containers that take one: vector, deque,
+ * hash_map, concurrent_hash_map, singly_linked_list, doubly_linked_list and arena_doubly_linked_list.
+ *
+ * Requests up to max_small bytes are rounded to a size class and served from a free list of the calling thread,
+ * without any lock. An empty list is refilled with a whole batch of blocks from the central heap, and a list grown
+ * past two batches gives one batch back, so the central mutexes are taken once every batch of operations. A block
+ * freed by a thread other than the one that allocated it simply lands in the freeing thread's cache: blocks of
+ * the same class are interchangeable, so producer/consumer patterns flow back to the central heap in batches.
+ * Larger or over-aligned requests go to ::operator new.
+ *
+ * @author Andrea Maggetto
+ */
+
+class thread_cache_heap{
+    public:
+        static constexpr size_t max_small = 32768;
+        static constexpr size_t classes = 23;
+
+        static void* allocate(size_t bytes);
+        static void deallocate(void* p, size_t bytes);
+
+    private:
+        struct block{
+            block* next;
+            block* next_batch;
+        };
+
+        struct central_list{
+            std::mutex mtx_;
+            block* batches = nullptr;
+            block* loose = nullptr;
+            char* span = nullptr;
+            size_t span_left = 0;
+        };
+
+        struct free_list{
+            block* head = nullptr;
+            size_t count = 0;
+        };
+
+        class cache;
+        class central;
+
+        static constexpr size_t span_bytes = 65536;
+        static inline thread_local bool cache_dead = false;
+
+        static size_t class_of(size_t bytes);
+        static size_t class_size(size_t c);
+        static size_t batch_size(size_t c);
+        static central& central_heap();
+        static cache* local_cache();
+};
+
+template<typename T>
+class thread_cache_allocator{
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using const_pointer = const T*;
+        using const_reference = const T&;
+        using size_type = size_t;
+
+        template<typename U>
+        struct rebind{
+            using other = thread_cache_allocator<U>;
+        };
+
+        thread_cache_allocator() = default;
+        ~thread_cache_allocator() = default;
+
+        thread_cache_allocator(const thread_cache_allocator<T>& a) noexcept = default;
+        thread_cache_allocator(thread_cache_allocator<T>&& a) noexcept = default;
+
+        thread_cache_allocator& operator=(const thread_cache_allocator<T>& a) = default;
+        thread_cache_allocator& operator=(thread_cache_allocator<T>&& a) = default;
+
+        template<typename U>
+        thread_cache_allocator(const thread_cache_allocator<U>&) noexcept{}
+
+        pointer address(reference r) const noexcept{
+            return &r;
+        }
+
+        const_pointer address(const_reference r) const noexcept{
+            return &r;
+        }
+
+        pointer allocate(size_type n, const_pointer = 0);
+        void deallocate(pointer p, size_type n);
+
+        template<typename U>
+        bool operator==(const thread_cache_allocator<U>&) const noexcept{
+            return true;
+        }
+
+        template<typename U>
+        bool operator!=(const thread_cache_allocator<U>& other) const noexcept{
+            return !(*this == other);
+        }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#include <atomic>
+#include <barrier>
+#include <thread>
+#include "bench.hpp"
+#include "../allocators/allocator.hpp"
+#include "../allocators/thread_cache_allocator.cpp"
+#include "../vector/vector.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file allocator_bench.cpp
+    @brief Multi-threaded alloc/free benchmark of thread_cache_allocator against the default allocator, which goes
+    straight to ::operator new.
+*/
+
+/**
+ * @brief Runs f(thread_index) on the given number of threads and waits for all of them.
+ */
+template<typename F>
+void run_threads(size_t threads, F f){
+    std::thread* pool = new std::thread[threads];
+    for(size_t t = 0; t < threads; ++t) pool[t] = std::thread(f, t);
+    for(size_t t = 0; t < threads; ++t) pool[t].join();
+    delete[] pool;
+}
+
+/**
+ * @brief Every thread keeps a window of live blocks of 16 to 256 bytes and keeps replacing a random one.
+ */
+template<template<typename> class Alloc>
+void churn(size_t threads, size_t ops_per_thread){
+    run_threads(threads, [&](size_t t){
+        constexpr size_t window = 256;
+        Alloc<char> a;
+        char* live[window];
+        size_t sizes[window];
+        bench_rng rng(t + 1);
+        for(size_t i = 0; i < window; ++i){
+            sizes[i] = 16 + rng.next() % 241;
+            live[i] = a.allocate(sizes[i]);
+        }
+        for(size_t i = 0; i < ops_per_thread; ++i){
+            const size_t slot = rng.next() % window;
+            a.deallocate(live[slot], sizes[slot]);
+            sizes[slot] = 16 + rng.next() % 241;
+            live[slot] = a.allocate(sizes[slot]);
+            live[slot][0] = char(i);
+        }
+        for(size_t i = 0; i < window; ++i) a.deallocate(live[i], sizes[i]);
+    });
+}
+
+/**
+ * @brief Every round, each thread allocates a batch of blocks and then frees the batch of its neighbour, so that
+ * every block is freed by a thread other than the one that allocated it.
+ */
+template<template<typename> class Alloc>
+void cross_thread(size_t threads, size_t rounds, size_t batch){
+    char** blocks = new char*[threads * batch];
+    std::barrier sync((std::ptrdiff_t)threads);
+    run_threads(threads, [&](size_t t){
+        Alloc<char> a;
+        char** mine = blocks + t * batch;
+        char** theirs = blocks + ((t + 1) % threads) * batch;
+        for(size_t r = 0; r < rounds; ++r){
+            for(size_t i = 0; i < batch; ++i){
+                mine[i] = a.allocate(64);
+                mine[i][0] = char(i);
+            }
+            sync.arrive_and_wait();
+            for(size_t i = 0; i < batch; ++i) a.deallocate(theirs[i], 64);
+            sync.arrive_and_wait();
+        }
+    });
+    delete[] blocks;
+}
+
+/**
+ * @brief Every thread repeatedly grows short vectors from empty, as per-request buffers do.
+ */
+template<template<typename> class Alloc>
+void vector_growth(size_t threads, size_t vectors_per_thread, size_t length){
+    run_threads(threads, [&](size_t){
+        long long total = 0;
+        for(size_t i = 0; i < vectors_per_thread; ++i){
+            vector<long long, Alloc<long long>> v;
+            for(size_t j = 0; j < length; ++j) v.push_back((long long)j);
+            total += v[length - 1];
+        }
+        do_not_optimize(total);
+    });
+}
+
+/**
+ * @brief Every thread uses a short singly_linked_list as a queue, so that every push and pop allocates or frees
+ * one node.
+ */
+template<template<typename> class Alloc>
+void list_queue(size_t threads, size_t ops_per_thread, size_t length){
+    run_threads(threads, [&](size_t){
+        singly_linked_list<long long, Alloc<long long>> l;
+        for(size_t j = 0; j < length; ++j) l.push_back((long long)j);
+        for(size_t i = 0; i < ops_per_thread; ++i){
+            l.pop_front();
+            l.push_back((long long)i);
+        }
+        do_not_optimize(l.get_size());
+    });
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 4000000);
+    const size_t thread_counts[] = {1, 2, 4, 8};
+    char name[64];
+
+    for(size_t threads : thread_counts){
+        std::snprintf(name, sizeof(name), "%zu thread(s)", threads);
+        bench_section(name);
+
+        const size_t ops = n / threads;
+        bench_run("churn 16-256 B, allocator", ops * threads, [&]{ churn<allocator>(threads, ops); });
+        bench_run("churn 16-256 B, thread_cache_allocator", ops * threads, [&]{
+            churn<thread_cache_allocator>(threads, ops);
+        });
+
+        if(threads > 1){
+            const size_t batch = 1024;
+            const size_t rounds = n / 4 / (threads * batch) + 1;
+            bench_run("cross-thread free 64 B, allocator", rounds * threads * batch, [&]{
+                cross_thread<allocator>(threads, rounds, batch);
+            });
+            bench_run("cross-thread free 64 B, thread_cache_allocator", rounds * threads * batch, [&]{
+                cross_thread<thread_cache_allocator>(threads, rounds, batch);
+            });
+        }
+
+        //items are push_backs
+        const size_t length = 64;
+        const size_t vectors = n / 8 / length / threads + 1;
+        bench_run("vector growth to 64, allocator", vectors * length * threads, [&]{
+            vector_growth<allocator>(threads, vectors, length);
+        });
+        bench_run("vector growth to 64, thread_cache_allocator", vectors * length * threads, [&]{
+            vector_growth<thread_cache_allocator>(threads, vectors, length);
+        });
+
+        //items are pop_front and push_back pairs
+        const size_t list_ops = n / 4 / threads;
+        bench_run("list queue of 64 nodes, allocator", list_ops * threads, [&]{
+            list_queue<allocator>(threads, list_ops, length);
+        });
+        bench_run("list queue of 64 nodes, thread_cache_allocator", list_ops * threads, [&]{
+            list_queue<thread_cache_allocator>(threads, list_ops, length);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <thread>
+#include "bench.hpp"
+#include "../vector/vector.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file batch_bench.cpp
+    @brief Contention benchmark of per-operation calls against lock_batch() handles and bulk calls.
+*/
+
+constexpr size_t group = 64;
+
+/**
+ * @brief Runs f(thread_index) on threads threads at once and waits for them.
+ */
+template<typename F>
+void run_threads(size_t threads, F f){
+    std::thread* pool = new std::thread[threads];
+    for(size_t t = 0; t < threads; ++t) pool[t] = std::thread(f, t);
+    for(size_t t = 0; t < threads; ++t) pool[t].join();
+    delete[] pool;
+}
+
+int main(int argc, char** argv){
+    const size_t ops = bench_size(argc, argv, 200000);
+    const size_t threads = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 2;
+    const size_t rounds = ops / group;
+    int values[group];
+    for(size_t i = 0; i < group; ++i) values[i] = int(i);
+
+    bench_section("vector push_back, all threads on one vector");
+    bench_run("per-op push_back", threads * rounds * group, [&]{
+        vector<int> v;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r) for(size_t i = 0; i < group; ++i) v.push_back(values[i]);
+        });
+    });
+    bench_run("lock_batch() push_back", threads * rounds * group, [&]{
+        vector<int> v;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r){
+                auto b = v.lock_batch();
+                for(size_t i = 0; i < group; ++i) b.push_back(values[i]);
+            }
+        });
+    });
+    bench_run("push_back_n", threads * rounds * group, [&]{
+        vector<int> v;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r) v.push_back_n(values, group);
+        });
+    });
+
+    bench_section("singly_linked_list as a shared queue, push then pop");
+    bench_run("per-op push_back/pop_front", threads * rounds * group * 2, [&]{
+        singly_linked_list<int> q;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r){
+                for(size_t i = 0; i < group; ++i) q.push_back(values[i]);
+                for(size_t i = 0; i < group; ++i) q.pop_front();
+            }
+        });
+    });
+    bench_run("lock_batch() push_back/pop_front", threads * rounds * group * 2, [&]{
+        singly_linked_list<int> q;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r){
+                {
+                    auto b = q.lock_batch();
+                    for(size_t i = 0; i < group; ++i) b.push_back(values[i]);
+                }
+                auto b = q.lock_batch();
+                for(size_t i = 0; i < group; ++i) b.pop_front();
+            }
+        });
+    });
+    bench_run("push_back_n/pop_front_n", threads * rounds * group * 2, [&]{
+        singly_linked_list<int> q;
+        run_threads(threads, [&](size_t){
+            for(size_t r = 0; r < rounds; ++r){
+                q.push_back_n(values, group);
+                q.pop_front_n(group);
+            }
+        });
+    });
+    return 0;
+}
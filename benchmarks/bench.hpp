@@ -0,0 +1,105 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+/**
+ * @file bench.hpp
+ * @brief Minimal harness shared by the standalone benchmark drivers of this directory.
+ *
+ * Every driver is a single translation unit with its own main() that includes the containers it measures,
+ * like the rest of the project, so it builds without any build system:
+ *
+ *     g++ -std=c++20 -O2 -march=native -pthread benchmarks/<name>_bench.cpp -o <name>_bench
+ *     ./<name>_bench [n]
+ *
+ * The optional argument overrides the problem size of the driver. Results are printed one per line as the
+ * best of a few runs, in milliseconds, nanoseconds per item and millions of items per second.
+ *
+ * @author Andrea Maggetto
+ */
+
+using bench_clock = std::chrono::steady_clock;
+
+/**
+ * @brief Keeps the compiler from optimizing away the computation of value.
+ */
+template<typename T>
+inline void do_not_optimize(const T& value){
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Returns the seconds elapsed since start.
+ */
+inline double bench_seconds(bench_clock::time_point start){
+    return std::chrono::duration<double>(bench_clock::now() - start).count();
+}
+
+/**
+ * @brief Prints one result line for items processed in seconds.
+ */
+inline void bench_report(const char* name, size_t items, double seconds){
+    std::printf("%-52s %10.2f ms %10.2f ns/item %10.2f Mitems/s\n",
+                name, seconds * 1e3, seconds * 1e9 / double(items), double(items) / seconds / 1e6);
+}
+
+/**
+ * @brief Prints the title of a group of results.
+ */
+inline void bench_section(const char* title){
+    std::printf("\n== %s ==\n", title);
+}
+
+/**
+ * @brief Runs f repeats times, prints the fastest run and returns its duration in seconds.
+ *
+ * @param name The label of the result.
+ * @param items The number of items processed by one call of f, used for the per-item figures.
+ * @param f The measured work.
+ * @param repeats The number of runs.
+ */
+template<typename F>
+double bench_run(const char* name, size_t items, F&& f, int repeats = 3){
+    double best = std::numeric_limits<double>::max();
+    for(int r = 0; r < repeats; ++r){
+        const bench_clock::time_point start = bench_clock::now();
+        f();
+        const double elapsed = bench_seconds(start);
+        if(elapsed < best) best = elapsed;
+    }
+    bench_report(name, items, best);
+    return best;
+}
+
+/**
+ * @brief Returns the problem size given on the command line, or fallback.
+ */
+inline size_t bench_size(int argc, char** argv, size_t fallback){
+    if(argc > 1){
+        const unsigned long long n = std::strtoull(argv[1], nullptr, 10);
+        if(n > 0) return static_cast<size_t>(n);
+    }
+    return fallback;
+}
+
+/**
+ * @brief Small xorshift generator, so that the drivers do not depend on <random> distributions.
+ */
+struct bench_rng{
+    unsigned long long state;
+
+    explicit bench_rng(unsigned long long seed = 0x9E3779B97F4A7C15ull) : state(seed ? seed : 1){}
+
+    unsigned long long next(){
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+#endif
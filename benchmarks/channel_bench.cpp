@@ -0,0 +1,155 @@
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include "bench.hpp"
+#include "../channel/channel.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file channel_bench.cpp
+    @brief Messages per second through the coroutine channel against threads blocking on a condition variable
+    around singly_linked_list.
+*/
+
+/**
+ * @brief The blocking approach: a bounded queue over singly_linked_list whose waiting producers and consumers
+ * sleep on condition variables, one OS thread each.
+ */
+template<typename T>
+class blocking_queue{
+    public:
+        explicit blocking_queue(size_t capacity) : capacity(capacity), closed(false){}
+
+        void send(const T& value){
+            std::unique_lock<std::mutex> lock(mtx);
+            not_full.wait(lock, [&]{ return items.get_size() < capacity; });
+            items.push_back(value);
+            lock.unlock();
+            not_empty.notify_one();
+        }
+        std::optional<T> receive(){
+            std::unique_lock<std::mutex> lock(mtx);
+            not_empty.wait(lock, [&]{ return items.get_size() > 0 || closed; });
+            T value;
+            if(items.pop_front_n(&value, 1) == 0) return std::nullopt;
+            lock.unlock();
+            not_full.notify_one();
+            return value;
+        }
+        void close(){
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                closed = true;
+            }
+            not_empty.notify_all();
+        }
+
+    private:
+        singly_linked_list<T> items;
+        size_t capacity;
+        bool closed;
+        std::mutex mtx;
+        std::condition_variable not_empty;
+        std::condition_variable not_full;
+};
+
+async_task produce(channel<long long>& ch, size_t n, std::atomic<size_t>& producers_left){
+    for(size_t i = 0; i < n; ++i) co_await ch.send((long long)i);
+    if(producers_left.fetch_sub(1) == 1) ch.close();
+}
+
+async_task consume(channel<long long>& ch, std::atomic<long long>& total){
+    long long sum = 0;
+    while(std::optional<long long> v = co_await ch.receive()) sum += *v;
+    total += sum;
+}
+
+/**
+ * @brief Moves producers * per_producer messages through a channel of the given capacity on executor e.
+ */
+template<typename Executor>
+long long run_channel(Executor& e, size_t producers, size_t consumers, size_t per_producer, size_t capacity){
+    channel<long long> ch(e, capacity);
+    std::atomic<size_t> producers_left{producers};
+    std::atomic<long long> total{0};
+    for(size_t i = 0; i < consumers; ++i) e.spawn(consume(ch, total));
+    for(size_t i = 0; i < producers; ++i) e.spawn(produce(ch, per_producer, producers_left));
+    if constexpr(std::is_same_v<Executor, single_thread_executor>) e.run();
+    else e.join();
+    return total.load();
+}
+
+/**
+ * @brief The same traffic through blocking_queue, with one thread per producer and per consumer.
+ */
+long long run_blocking(size_t producers, size_t consumers, size_t per_producer, size_t capacity){
+    blocking_queue<long long> q(capacity);
+    std::atomic<size_t> producers_left{producers};
+    std::atomic<long long> total{0};
+    std::thread* threads = new std::thread[producers + consumers];
+    for(size_t i = 0; i < consumers; ++i){
+        threads[i] = std::thread([&]{
+            long long sum = 0;
+            while(std::optional<long long> v = q.receive()) sum += *v;
+            total += sum;
+        });
+    }
+    for(size_t i = 0; i < producers; ++i){
+        threads[consumers + i] = std::thread([&]{
+            for(size_t j = 0; j < per_producer; ++j) q.send((long long)j);
+            if(producers_left.fetch_sub(1) == 1) q.close();
+        });
+    }
+    for(size_t i = 0; i < producers + consumers; ++i) threads[i].join();
+    delete[] threads;
+    return total.load();
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 400000);
+    const size_t capacity = 64;
+
+    single_thread_executor single;
+    thread_pool_executor pool;
+
+    struct shape{
+        const char* title;
+        size_t producers;
+        size_t consumers;
+    };
+    const shape shapes[] = {
+        {"1 producer, 1 consumer, capacity 64", 1, 1},
+        {"8 producers, 8 consumers, capacity 64", 8, 8},
+        {"64 producers, 64 consumers, capacity 64", 64, 64},
+    };
+
+    for(const shape& s : shapes){
+        const size_t per_producer = n / s.producers;
+        const size_t messages = per_producer * s.producers;
+        bench_section(s.title);
+        bench_run("blocking queue, one thread per endpoint", messages, [&]{
+            do_not_optimize(run_blocking(s.producers, s.consumers, per_producer, capacity));
+        });
+        bench_run("channel on single_thread_executor", messages, [&]{
+            do_not_optimize(run_channel(single, s.producers, s.consumers, per_producer, capacity));
+        });
+        bench_run("channel on thread_pool_executor", messages, [&]{
+            do_not_optimize(run_channel(pool, s.producers, s.consumers, per_producer, capacity));
+        });
+    }
+
+    //thousands of endpoints: only the coroutines can afford one per producer and consumer
+    const size_t endpoints = 2000;
+    const size_t per_producer = n / endpoints > 0 ? n / endpoints : 1;
+    bench_section("2000 producers, 2000 consumers, capacity 64 (channel only)");
+    bench_run("channel on single_thread_executor", per_producer * endpoints, [&]{
+        do_not_optimize(run_channel(single, endpoints, endpoints, per_producer, capacity));
+    });
+    bench_run("channel on thread_pool_executor", per_producer * endpoints, [&]{
+        do_not_optimize(run_channel(pool, endpoints, endpoints, per_producer, capacity));
+    });
+    return 0;
+}
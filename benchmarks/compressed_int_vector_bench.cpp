@@ -0,0 +1,94 @@
+#include <cstdint>
+#include <cstdio>
+#include "bench.hpp"
+#include "../vector/vector.cpp"
+#include "../vector/compressed_int_vector.cpp"
+
+/*
+    @file compressed_int_vector_bench.cpp
+    @brief Compression ratio and scan throughput of compressed_int_vector against vector<uint64_t>, for sorted ids,
+    timestamps, small unsorted values and incompressible random values.
+*/
+
+/**
+ * @brief Fills v with n values of the named distribution.
+ */
+void generate(vector<uint64_t>& v, const char* kind, size_t n){
+    bench_rng rng;
+    uint64_t last = 1000000;
+    for(size_t i = 0; i < n; ++i){
+        switch(kind[0]){
+            case 'i': last += 1 + rng.next() % 16; v.push_back(last); break;                 //sorted ids, small gaps
+            case 't': last += 1000 + rng.next() % 50; v.push_back(last); break;              //timestamps in microseconds
+            case 's': v.push_back(rng.next() % (uint64_t(1) << 20)); break;                  //small unsorted values
+            default: v.push_back(rng.next()); break;                                         //random 64 bit values
+        }
+    }
+}
+
+/**
+ * @brief Prints the throughput of a scan of raw_bytes of uncompressed data in GB/s.
+ */
+void report_bandwidth(const char* name, size_t raw_bytes, double seconds){
+    std::printf("%-52s %10.2f GB/s\n", name, double(raw_bytes) / seconds / 1e9);
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, size_t(1) << 24);
+    const size_t raw_bytes = n * sizeof(uint64_t);
+    const size_t lookups = n / 16;
+    const char* kinds[] = {"ids (sorted, gaps 1-16)", "timestamps (gaps 1000-1049)", "small unsorted (< 2^20)", "random 64 bit"};
+
+    for(const char* kind : kinds){
+        vector<uint64_t> plain;
+        generate(plain, kind, n);
+        compressed_int_vector packed;
+        for(const uint64_t x : static_cast<const vector<uint64_t>&>(plain)) packed.push_back(x);
+
+        bench_section(kind);
+        std::printf("%-52s %10.2f MiB -> %.2f MiB, ratio %.2fx\n", "memory", double(raw_bytes) / (1 << 20),
+                    double(packed.memory_bytes()) / (1 << 20), double(raw_bytes) / double(packed.memory_bytes()));
+
+        const vector<uint64_t>& cplain = plain;
+        const compressed_int_vector& cpacked = packed;
+
+        double s = bench_run("vector<uint64_t> const_iterator scan", n, [&]{
+            uint64_t total = 0;
+            for(const uint64_t x : cplain) total += x;
+            do_not_optimize(total);
+        });
+        report_bandwidth("  vector<uint64_t>", raw_bytes, s);
+
+        s = bench_run("compressed_int_vector const_iterator scan", n, [&]{
+            uint64_t total = 0;
+            for(const uint64_t x : cpacked) total += x;
+            do_not_optimize(total);
+        });
+        report_bandwidth("  compressed_int_vector const_iterator", raw_bytes, s);
+
+        s = bench_run("compressed_int_vector decode_block scan", n, [&]{
+            uint64_t out[compressed_int_vector::block_size];
+            uint64_t total = 0;
+            for(size_t b = 0; b * compressed_int_vector::block_size < n; ++b){
+                const size_t count = cpacked.decode_block(b, out);
+                for(size_t i = 0; i < count; ++i) total += out[i];
+            }
+            do_not_optimize(total);
+        });
+        report_bandwidth("  compressed_int_vector decode_block", raw_bytes, s);
+
+        bench_run("vector<uint64_t> random operator[]", lookups, [&]{
+            bench_rng rng(7);
+            uint64_t total = 0;
+            for(size_t i = 0; i < lookups; ++i) total += cplain[rng.next() % n];
+            do_not_optimize(total);
+        });
+        bench_run("compressed_int_vector random operator[]", lookups, [&]{
+            bench_rng rng(7);
+            uint64_t total = 0;
+            for(size_t i = 0; i < lookups; ++i) total += cpacked[rng.next() % n];
+            do_not_optimize(total);
+        });
+    }
+    return 0;
+}
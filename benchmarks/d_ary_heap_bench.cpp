@@ -0,0 +1,137 @@
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include "bench.hpp"
+#include "../heap/d_ary_heap.cpp"
+#include "../list/doubly_linked_list/doubly_linked_list.cpp"
+
+/*
+    @file d_ary_heap_bench.cpp
+    @brief Timer-wheel-like benchmark of d_ary_heap (arity 2, 4 and 8) against timers kept in a sorted
+    doubly_linked_list.
+
+    A fixed number of timers is pending; every operation expires the earliest one and re-arms it with a random
+    delay. In the second scenario every other operation also reschedules a random pending timer, through a heap
+    handle or by erasing and re-inserting the list node. The heaps are unlocked, except one std::mutex heap that
+    shows the cost of the concurrent mode.
+*/
+
+struct timer{
+    long long deadline;
+    size_t id;
+
+    bool operator<(const timer& t) const{
+        return deadline < t.deadline || (deadline == t.deadline && id < t.id);
+    }
+    bool operator>(const timer& t) const{
+        return t < *this;
+    }
+};
+
+/**
+ * @brief Timers in a doubly_linked_list sorted by deadline: O(n) insert, O(1) expiry.
+ */
+class sorted_list_timers{
+    public:
+        explicit sorted_list_timers(size_t timers) : nodes(new std::optional<doubly_linked_list<timer>::iterator>[timers]){}
+        ~sorted_list_timers(){
+            delete[] nodes;
+        }
+
+        void arm(const timer& t){
+            doubly_linked_list<timer>::iterator it = list.begin();
+            while(it != list.end() && !(t < *it)) ++it;
+            nodes[t.id] = list.insert(it, t);
+        }
+        timer expire(){
+            const timer t = *list.begin();
+            list.erase(list.begin());
+            return t;
+        }
+        void reschedule(size_t id, long long deadline){
+            list.erase(*nodes[id]);
+            arm(timer{deadline, id});
+        }
+
+    private:
+        doubly_linked_list<timer> list;
+        std::optional<doubly_linked_list<timer>::iterator>* nodes;
+};
+
+/**
+ * @brief Timers in a min d_ary_heap, with one handle per timer for rescheduling.
+ */
+template<size_t Arity, typename Mutex = null_mutex>
+class heap_timers{
+    public:
+        explicit heap_timers(size_t timers) : handles(new size_t[timers]){}
+        ~heap_timers(){
+            delete[] handles;
+        }
+
+        void arm(const timer& t){
+            handles[t.id] = heap.push(t);
+        }
+        timer expire(){
+            return heap.pop();
+        }
+        void reschedule(size_t id, long long deadline){
+            heap.update(handles[id], timer{deadline, id});
+        }
+
+    private:
+        d_ary_heap<timer, Arity, std::greater<timer>, Mutex> heap;
+        size_t* handles;
+};
+
+/**
+ * @brief Arms timers timers, then measures ops expire-and-re-arm operations, rescheduling a random timer every
+ * other operation when reschedule is set. The number of pending timers stays the same, so the runs are alike.
+ */
+template<typename Timers>
+void measure(const char* name, size_t timers, size_t ops, bool reschedule){
+    Timers q(timers);
+    bench_rng rng;
+    for(size_t id = 0; id < timers; ++id) q.arm(timer{(long long)(rng.next() % 1000000), id});
+
+    long long now = 0;
+    bench_run(name, ops, [&]{
+        for(size_t i = 0; i < ops; ++i){
+            const timer t = q.expire();
+            now = t.deadline;
+            q.arm(timer{now + 1 + (long long)(rng.next() % 1000000), t.id});
+            if(reschedule && (i & 1)){
+                //the expired timer was just re-armed, so every id is pending
+                q.reschedule(rng.next() % timers, now + 1 + (long long)(rng.next() % 1000000));
+            }
+        }
+        do_not_optimize(now);
+    });
+}
+
+int main(int argc, char** argv){
+    const size_t ops = bench_size(argc, argv, 20000);
+    const size_t sizes[] = {1000, 10000};
+    char title[96];
+
+    for(const bool reschedule : {false, true}){
+        for(const size_t timers : sizes){
+            std::snprintf(title, sizeof(title), "%zu pending timers, expire and re-arm%s", timers,
+                          reschedule ? ", reschedule every other" : "");
+            bench_section(title);
+            measure<sorted_list_timers>("sorted doubly_linked_list", timers, ops, reschedule);
+            measure<heap_timers<2>>("d_ary_heap<2>", timers, ops, reschedule);
+            measure<heap_timers<4>>("d_ary_heap<4>", timers, ops, reschedule);
+            measure<heap_timers<8>>("d_ary_heap<8>", timers, ops, reschedule);
+            measure<heap_timers<4, std::mutex>>("d_ary_heap<4>, std::mutex", timers, ops, reschedule);
+        }
+    }
+
+    //the sorted list would take minutes just to arm this many timers
+    const size_t many = 1000000;
+    bench_section("1000000 pending timers, expire and re-arm (heaps only)");
+    measure<heap_timers<2>>("d_ary_heap<2>", many, ops * 10, false);
+    measure<heap_timers<4>>("d_ary_heap<4>", many, ops * 10, false);
+    measure<heap_timers<8>>("d_ary_heap<8>", many, ops * 10, false);
+    return 0;
+}
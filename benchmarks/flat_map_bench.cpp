@@ -0,0 +1,105 @@
+#include <map>
+#include <set>
+#include "bench.hpp"
+#include "../vector/flat_set.cpp"
+#include "../vector/flat_map.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file flat_map_bench.cpp
+    @brief Bulk build and lookups of flat_set/flat_map against std::set/std::map and list search.
+*/
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 200000);
+    const size_t lookups = 500000;
+    const size_t list_n = n < 4096 ? n : 4096;
+    const size_t list_lookups = 20000;
+
+    bench_rng rng;
+    vector<long long> keys;
+    vector<std::pair<long long, long long>> pairs;
+    for(size_t i = 0; i < n; ++i){
+        // even keys only, so that odd probes are guaranteed misses
+        const long long key = (long long)(rng.next() % (n * 8)) * 2;
+        keys.push_back(key);
+        pairs.push_back({key, (long long)i});
+    }
+    vector<long long> probes;
+    for(size_t i = 0; i < lookups; ++i) probes.push_back(i % 2 ? keys[rng.next() % n] : (long long)(rng.next() % (n * 16)) | 1);
+
+    bench_section("bulk build from unsorted keys");
+    bench_run("flat_set(unsorted)", n, [&]{ flat_set<long long> s(keys); do_not_optimize(s.get_size()); });
+    bench_run("flat_map(unsorted)", n, [&]{ flat_map<long long, long long> m(pairs); do_not_optimize(m.get_size()); });
+    bench_run("std::set insert", n, [&]{
+        std::set<long long> s;
+        for(size_t i = 0; i < n; ++i) s.insert(keys[i]);
+        do_not_optimize(s.size());
+    });
+    bench_run("std::map insert", n, [&]{
+        std::map<long long, long long> m;
+        for(size_t i = 0; i < n; ++i) m.emplace(pairs[i].first, pairs[i].second);
+        do_not_optimize(m.size());
+    });
+
+    flat_set<long long> fs(keys);
+    flat_map<long long, long long> fm(pairs);
+    std::set<long long> ss;
+    std::map<long long, long long> sm;
+    for(size_t i = 0; i < n; ++i){
+        ss.insert(keys[i]);
+        sm.emplace(pairs[i].first, pairs[i].second);
+    }
+
+    bench_section("lookups, half hits and half misses");
+    bench_run("flat_set contains", lookups, [&]{
+        size_t hits = 0;
+        for(size_t i = 0; i < lookups; ++i) hits += fs.contains(probes[i]);
+        do_not_optimize(hits);
+    });
+    bench_run("flat_map get", lookups, [&]{
+        long long sum = 0;
+        for(size_t i = 0; i < lookups; ++i) sum += fm.get(probes[i]).value_or(0);
+        do_not_optimize(sum);
+    });
+    bench_run("std::set count", lookups, [&]{
+        size_t hits = 0;
+        for(size_t i = 0; i < lookups; ++i) hits += ss.count(probes[i]);
+        do_not_optimize(hits);
+    });
+    bench_run("std::map find", lookups, [&]{
+        long long sum = 0;
+        for(size_t i = 0; i < lookups; ++i){
+            auto it = sm.find(probes[i]);
+            if(it != sm.end()) sum += it->second;
+        }
+        do_not_optimize(sum);
+    });
+
+    singly_linked_list<long long> list;
+    vector<long long> small_keys;
+    for(size_t i = 0; i < list_n; ++i){
+        list.push_back(keys[i]);
+        small_keys.push_back(keys[i]);
+    }
+    flat_set<long long> small_set(small_keys);
+
+    bench_section("lookups in the first 4096 keys, half hits and half misses");
+    bench_run("singly_linked_list search", list_lookups, [&]{
+        size_t hits = 0;
+        for(size_t i = 0; i < list_lookups; ++i){
+            try{
+                list.search(i % 2 ? small_keys[i % list_n] : (long long)i * 2 + 1);
+                ++hits;
+            }
+            catch(const std::runtime_error&){}
+        }
+        do_not_optimize(hits);
+    }, 1);
+    bench_run("flat_set contains", list_lookups, [&]{
+        size_t hits = 0;
+        for(size_t i = 0; i < list_lookups; ++i) hits += small_set.contains(i % 2 ? small_keys[i % list_n] : (long long)i * 2 + 1);
+        do_not_optimize(hits);
+    });
+    return 0;
+}
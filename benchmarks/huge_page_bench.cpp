@@ -0,0 +1,96 @@
+#include <cstdio>
+#include "bench.hpp"
+#include "../allocators/huge_page_allocator.cpp"
+#include "../vector/vector.cpp"
+
+/*
+    @file huge_page_bench.cpp
+    @brief Scan and growth benchmarks of vector<double> on 4 KiB pages, through the default allocator, against
+    vector<double, huge_page_allocator<double>> on 2 MiB pages.
+
+    The default allocator gets 4 KiB pages unless transparent huge pages are set to "always", so the driver prints
+    the system setting first.
+*/
+
+/**
+ * @brief Prints the transparent huge page setting of the kernel, if it is readable.
+ */
+void print_thp_setting(){
+    char line[128] = "unknown";
+    if(std::FILE* f = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r")){
+        if(!std::fgets(line, sizeof(line), f)) std::snprintf(line, sizeof(line), "unknown\n");
+        std::fclose(f);
+    }
+    std::printf("transparent_hugepage: %s", line);
+}
+
+/**
+ * @brief Grows v to n elements one push_back at a time.
+ */
+template<typename Vector>
+void grow(Vector& v, size_t n){
+    for(size_t i = 0; i < n; ++i) v.push_back(double(i));
+}
+
+/**
+ * @brief Sums the elements of v in order through operator[].
+ */
+template<typename Vector>
+double sequential_scan(Vector& v, size_t n){
+    typename Vector::batch b = v.lock_batch();
+    double total = 0;
+    for(size_t i = 0; i < n; ++i) total += b[i];
+    return total;
+}
+
+/**
+ * @brief Sums count elements of v at random positions through operator[], where TLB misses dominate.
+ */
+template<typename Vector>
+double random_scan(Vector& v, size_t n, size_t count){
+    typename Vector::batch b = v.lock_batch();
+    bench_rng rng;
+    double total = 0;
+    for(size_t i = 0; i < count; ++i) total += b[rng.next() % n];
+    return total;
+}
+
+/**
+ * @brief Measures growth to n elements and both scans for one allocator configuration.
+ */
+template<typename Alloc>
+void measure(const char* label, size_t n, const Alloc& a){
+    using Vector = vector<double, Alloc>;
+    char name[96];
+    const size_t lookups = n / 4;
+
+    std::snprintf(name, sizeof(name), "%s: push_back growth", label);
+    bench_run(name, n, [&]{
+        Vector v(a);
+        grow(v, n);
+        do_not_optimize(v.get_size());
+    });
+
+    Vector v(a);
+    grow(v, n);
+    std::snprintf(name, sizeof(name), "%s: sequential scan", label);
+    bench_run(name, n, [&]{ do_not_optimize(sequential_scan(v, n)); });
+    std::snprintf(name, sizeof(name), "%s: random scan", label);
+    bench_run(name, lookups, [&]{ do_not_optimize(random_scan(v, n, lookups)); });
+}
+
+int main(int argc, char** argv){
+    //128 MiB of doubles by default
+    const size_t n = bench_size(argc, argv, size_t(16) << 20);
+
+    print_thp_setting();
+
+    bench_section("4 KiB pages (default allocator)");
+    measure("allocator", n, allocator<double>());
+
+    bench_section("2 MiB pages (huge_page_allocator)");
+    measure("transparent", n, huge_page_allocator<double>(huge_page_mode::transparent));
+    measure("transparent, prefault", n, huge_page_allocator<double>(huge_page_mode::transparent, true));
+    measure("explicit_pages", n, huge_page_allocator<double>(huge_page_mode::explicit_pages));
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "bench.hpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+#include "../list/doubly_linked_list/doubly_linked_list.cpp"
+
+/*
+    @file list_locality_bench.cpp
+    @brief Iteration over the linked lists, fresh and after churn, with and without locality mode, prefetching
+    and compact().
+*/
+
+template<typename T>
+void pop_front(singly_linked_list<T>& l){
+    l.pop_front();
+}
+
+template<typename T>
+void pop_front(doubly_linked_list<T>& l){
+    l.erase(l.begin());
+}
+
+/**
+ * @brief Replaces every node of l once, interleaving allocations of a throwaway list, so that the nodes end up
+ * scattered over the heap in an order unrelated to the list order.
+ */
+template<typename L>
+void churn(L& l, size_t n){
+    bench_rng rng(3);
+    L noise;
+    for(size_t i = 0; i < n; ++i){
+        pop_front(l);
+        for(unsigned k = rng.next() % 4; k > 0; --k) noise.push_back(0);
+        l.push_back((long long)i);
+    }
+}
+
+template<typename L>
+long long sum(L& l){
+    long long total = 0;
+    for(auto it = l.begin(); it != l.end(); ++it) total += *it;
+    return total;
+}
+
+template<typename L>
+void run(const char* title, size_t n){
+    bench_section(title);
+    auto scan = [](L& l){ do_not_optimize(sum(l)); };
+
+    L fresh;
+    for(size_t i = 0; i < n; ++i) fresh.push_back((long long)i);
+    bench_run("fresh, heap nodes", n, [&]{ scan(fresh); });
+
+    L churned;
+    for(size_t i = 0; i < n; ++i) churned.push_back((long long)i);
+    churn(churned, n);
+    bench_run("after churn, heap nodes", n, [&]{ scan(churned); });
+    churned.set_prefetch_distance(8);
+    bench_run("after churn, heap nodes, prefetch 8", n, [&]{ scan(churned); });
+
+    L local;
+    local.set_locality(true);
+    for(size_t i = 0; i < n; ++i) local.push_back((long long)i);
+    churn(local, n);
+    bench_run("after churn, locality mode", n, [&]{ scan(local); });
+    local.compact();
+    bench_run("after churn, locality mode, compact()", n, [&]{ scan(local); });
+    local.set_prefetch_distance(8);
+    bench_run("after churn, locality mode, compact(), prefetch 8", n, [&]{ scan(local); });
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 1000000);
+    run<singly_linked_list<long long>>("singly_linked_list iteration", n);
+    run<doubly_linked_list<long long>>("doubly_linked_list iteration", n);
+    return 0;
+}
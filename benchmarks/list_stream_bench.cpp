@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include "bench.hpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+#include "../list/doubly_linked_list/doubly_linked_list.cpp"
+
+/*
+    @file list_stream_bench.cpp
+    @brief Throughput in GB/s of the binary write_to / read_from of both lists against the text operator<<, all on
+    in-memory streams so that the figures measure the encoding rather than a disk. GB/s count the raw element
+    bytes, n * sizeof(T), whatever the size of the output.
+*/
+
+/**
+ * @brief The text output of doubly_linked_list's operator<<, element by element, for a list that has none.
+ */
+template<typename L>
+void write_text(std::ostream& os, const L& l){
+    os << "[";
+    bool first = true;
+    for(const auto& x : l){
+        if(!first) os << ", ";
+        os << x;
+        first = false;
+    }
+    os << "]";
+}
+
+/**
+ * @brief Prints the throughput of a pass over raw_bytes of elements in GB/s.
+ */
+void report_bandwidth(const char* name, size_t raw_bytes, double seconds){
+    std::printf("%-52s %10.2f GB/s\n", name, double(raw_bytes) / seconds / 1e9);
+}
+
+/**
+ * @brief Measures text output, binary output, binary input into a new list and decoding without a list.
+ */
+template<typename L>
+void measure(const char* label, const L& l, size_t n){
+    const size_t raw_bytes = n * sizeof(long long);
+    char name[96];
+
+    std::snprintf(name, sizeof(name), "%s operator<< (text)", label);
+    double s = bench_run(name, n, [&]{
+        std::ostringstream os;
+        if constexpr(requires{ os << l; }) os << l;
+        else write_text(os, l);
+        do_not_optimize(os.tellp());
+    });
+    report_bandwidth("  text", raw_bytes, s);
+
+    std::snprintf(name, sizeof(name), "%s write_to", label);
+    s = bench_run(name, n, [&]{
+        std::ostringstream os(std::ios::binary);
+        l.write_to(os);
+        do_not_optimize(os.tellp());
+    });
+    report_bandwidth("  write_to", raw_bytes, s);
+
+    std::ostringstream encoded(std::ios::binary);
+    l.write_to(encoded);
+    const std::string bytes = encoded.str();
+
+    std::snprintf(name, sizeof(name), "%s read_from into a new list", label);
+    s = bench_run(name, n, [&]{
+        std::istringstream is(bytes, std::ios::binary);
+        L copy;
+        do_not_optimize(copy.read_from(is));
+    });
+    report_bandwidth("  read_from", raw_bytes, s);
+
+    std::snprintf(name, sizeof(name), "%s list_stream_for_each (no list)", label);
+    s = bench_run(name, n, [&]{
+        std::istringstream is(bytes, std::ios::binary);
+        long long total = 0;
+        list_stream_for_each<long long>(is, [&](const long long& x){ total += x; });
+        do_not_optimize(total);
+    });
+    report_bandwidth("  list_stream_for_each", raw_bytes, s);
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 2000000);
+
+    singly_linked_list<long long> sl;
+    doubly_linked_list<long long> dl;
+    bench_rng rng;
+    for(size_t i = 0; i < n; ++i){
+        const long long x = (long long)(rng.next() >> 1);
+        sl.push_back(x);
+        dl.push_back(x);
+    }
+
+    bench_section("singly_linked_list<long long>");
+    measure("singly_linked_list", sl, n);
+    bench_section("doubly_linked_list<long long>");
+    measure("doubly_linked_list", dl, n);
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "bench.hpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+#include "../list/persistent_singly_linked_list/persistent_singly_linked_list.cpp"
+
+/*
+    @file persistent_list_bench.cpp
+    @brief Benchmark of persistent_singly_linked_list versions against the copy-then-modify pattern on
+    singly_linked_list, where every version handed to another thread is a full copy.
+*/
+
+using plain_list = singly_linked_list<long long>;
+using persistent_list = persistent_singly_linked_list<long long>;
+
+/**
+ * @brief Sums the elements of a version, as a reader does.
+ */
+template<typename List>
+long long sum(const List& l){
+    long long total = 0;
+    for(const long long x : l) total += x;
+    return total;
+}
+
+/**
+ * @brief One writer keeps replacing the front element of current while readers repeatedly take the current
+ * version under a mutex and sum it outside the lock. Returns once every reader took snapshots versions.
+ *
+ * @param publish Called by the writer under the mutex to derive the next version from the current one.
+ * @param snapshot Called by a reader under the mutex to take its own copy of the current version.
+ */
+template<typename List, typename Publish, typename Snapshot>
+void readers_and_writer(List& current, size_t readers, size_t snapshots, Publish publish, Snapshot snapshot){
+    std::mutex mtx;
+    std::atomic<size_t> readers_left{readers};
+    std::thread writer([&]{
+        long long x = 0;
+        while(readers_left.load(std::memory_order_relaxed) > 0){
+            std::lock_guard<std::mutex> lock(mtx);
+            publish(current, x++);
+        }
+    });
+    std::thread* pool = new std::thread[readers];
+    for(size_t r = 0; r < readers; ++r){
+        pool[r] = std::thread([&]{
+            long long total = 0;
+            for(size_t i = 0; i < snapshots; ++i){
+                std::unique_lock<std::mutex> lock(mtx);
+                const List mine = snapshot(current);
+                lock.unlock();
+                total += sum(mine);
+            }
+            do_not_optimize(total);
+            readers_left.fetch_sub(1);
+        });
+    }
+    for(size_t r = 0; r < readers; ++r) pool[r].join();
+    writer.join();
+    delete[] pool;
+}
+
+int main(int argc, char** argv){
+    const size_t length = bench_size(argc, argv, 10000);
+    const size_t versions = 2000;
+    const size_t readers = 4;
+    const size_t snapshots = 200;
+
+    plain_list plain_base;
+    persistent_list persistent_base;
+    for(size_t i = 0; i < length; ++i){
+        plain_base.push_front((long long)i);
+        persistent_base = persistent_base.push_front((long long)i);
+    }
+
+    bench_section("derive a version with one more element (items are versions)");
+    bench_run("singly_linked_list copy + push_front", versions, [&]{
+        for(size_t v = 0; v < versions; ++v){
+            plain_list next(plain_base);
+            next.push_front((long long)v);
+            do_not_optimize(next.get_size());
+        }
+    });
+    bench_run("persistent_singly_linked_list push_front", versions, [&]{
+        for(size_t v = 0; v < versions; ++v){
+            const persistent_list next = persistent_base.push_front((long long)v);
+            do_not_optimize(next.get_size());
+        }
+    });
+
+    bench_section("hand a version to another thread (items are copies)");
+    bench_run("singly_linked_list copy", versions, [&]{
+        for(size_t v = 0; v < versions; ++v){
+            const plain_list copy(plain_base);
+            do_not_optimize(copy.get_size());
+        }
+    });
+    bench_run("persistent_singly_linked_list copy", versions, [&]{
+        for(size_t v = 0; v < versions; ++v){
+            const persistent_list copy(persistent_base);
+            do_not_optimize(copy.get_size());
+        }
+    });
+
+    bench_section("scan a version (items are elements)");
+    bench_run("singly_linked_list", length, [&]{ do_not_optimize(sum(static_cast<const plain_list&>(plain_base))); });
+    bench_run("persistent_singly_linked_list", length, [&]{ do_not_optimize(sum(persistent_base)); });
+
+    bench_section("4 readers snapshot and scan while 1 writer publishes (items are snapshots)");
+    bench_run("singly_linked_list, copy under the lock", readers * snapshots, [&]{
+        plain_list current(plain_base);
+        readers_and_writer(current, readers, snapshots,
+            [](plain_list& l, long long x){
+                l.pop_front();
+                l.push_front(x);
+            },
+            [](const plain_list& l){ return plain_list(l); });
+    });
+    bench_run("persistent_singly_linked_list, O(1) copy", readers * snapshots, [&]{
+        persistent_list current(persistent_base);
+        readers_and_writer(current, readers, snapshots,
+            [](persistent_list& l, long long x){ l = l.pop_front().push_front(x); },
+            [](const persistent_list& l){ return persistent_list(l); });
+    });
+    return 0;
+}
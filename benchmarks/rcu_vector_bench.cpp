@@ -0,0 +1,72 @@
+#include <atomic>
+#include <thread>
+#include "bench.hpp"
+#include "../vector/rcu_vector.cpp"
+
+/*
+    @file rcu_vector_bench.cpp
+    @brief Reader throughput of rcu_vector and of the locked vector, alone and during a storm of writes.
+*/
+
+constexpr double run_seconds = 0.3;
+
+/**
+ * @brief Runs readers threads calling read_one for run_seconds while, if storm is set, one more thread
+ * calls write_one in a loop. Prints the total number of reads.
+ */
+template<typename Read, typename Write>
+void reader_throughput(const char* name, size_t readers, bool storm, Read read_one, Write write_one){
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> total{0};
+    std::thread writer;
+    if(storm) writer = std::thread([&]{
+        bench_rng rng(7);
+        while(!stop.load(std::memory_order_relaxed)) write_one(rng.next());
+    });
+
+    std::thread* threads = new std::thread[readers];
+    const bench_clock::time_point start = bench_clock::now();
+    for(size_t t = 0; t < readers; ++t){
+        threads[t] = std::thread([&, t]{
+            bench_rng rng(t + 1);
+            size_t reads = 0;
+            long long sum = 0;
+            while(!stop.load(std::memory_order_relaxed)){
+                for(int i = 0; i < 256; ++i) sum += read_one(rng.next());
+                reads += 256;
+            }
+            do_not_optimize(sum);
+            total += reads;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(run_seconds));
+    stop = true;
+    for(size_t t = 0; t < readers; ++t) threads[t].join();
+    const double elapsed = bench_seconds(start);
+    if(storm) writer.join();
+    delete[] threads;
+
+    bench_report(name, total.load(), elapsed);
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 4096);
+    const size_t readers = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() - 1 : 2;
+
+    rcu_vector<long long> rcu(0, n);
+    vector<long long> locked(0, n);
+
+    bench_section("reads per second, wait-free rcu_vector vs locked vector");
+    reader_throughput("rcu_vector read(), no writer", readers, false,
+                      [&](unsigned long long r){ return rcu.read()[r % n]; }, [](unsigned long long){});
+    reader_throughput("rcu_vector read(), writer storm", readers, true,
+                      [&](unsigned long long r){ return rcu.read()[r % n]; },
+                      [&](unsigned long long r){ rcu.store(r % n, (long long)r); });
+    reader_throughput("vector operator[] const, no writer", readers, false,
+                      [&](unsigned long long r){ return static_cast<const vector<long long>&>(locked)[r % n]; }, [](unsigned long long){});
+    reader_throughput("vector operator[] const, writer storm", readers, true,
+                      [&](unsigned long long r){ return static_cast<const vector<long long>&>(locked)[r % n]; },
+                      [&](unsigned long long r){ locked[r % n] = (long long)r; });
+    return 0;
+}
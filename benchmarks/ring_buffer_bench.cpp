@@ -0,0 +1,144 @@
+#include <thread>
+#include "bench.hpp"
+#include "../ring_buffer/spsc_ring_buffer.cpp"
+#include "../ring_buffer/mpmc_ring_buffer.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file ring_buffer_bench.cpp
+    @brief Throughput and round-trip latency of the ring buffers against a singly_linked_list used as a queue.
+*/
+
+/**
+ * @brief The locked list queue behind the same try_push/try_pop interface as the ring buffers.
+ */
+struct list_queue{
+    singly_linked_list<long long> list;
+
+    bool try_push(const long long& el){
+        list.push_back(el);
+        return true;
+    }
+    bool try_pop(long long& out){
+        return list.pop_front_n(&out, 1) == 1;
+    }
+};
+
+/**
+ * @brief Moves items values from producers threads to as many consumer threads through q.
+ */
+template<typename Q>
+void transfer(Q& q, size_t items, size_t producers){
+    std::thread* threads = new std::thread[2 * producers];
+    const size_t share = items / producers;
+    for(size_t p = 0; p < producers; ++p){
+        threads[p] = std::thread([&q, share]{
+            for(size_t i = 0; i < share; ++i) while(!q.try_push((long long)i)) std::this_thread::yield();
+        });
+        threads[producers + p] = std::thread([&q, share]{
+            long long value, sum = 0;
+            for(size_t i = 0; i < share; ++i){
+                while(!q.try_pop(value)) std::this_thread::yield();
+                sum += value;
+            }
+            do_not_optimize(sum);
+        });
+    }
+    for(size_t t = 0; t < 2 * producers; ++t) threads[t].join();
+    delete[] threads;
+}
+
+/**
+ * @brief Moves items values from one producer to one consumer, 64 at a time with push_n/pop_n.
+ */
+template<typename Q>
+void transfer_batched(Q& q, size_t items){
+    constexpr size_t group = 64;
+    std::thread producer([&q, items]{
+        long long buffer[group];
+        for(size_t i = 0; i < group; ++i) buffer[i] = (long long)i;
+        for(size_t sent = 0; sent < items;){
+            const size_t pushed = q.push_n(buffer, items - sent < group ? items - sent : group);
+            if(!pushed) std::this_thread::yield();
+            sent += pushed;
+        }
+    });
+    long long buffer[group], sum = 0;
+    for(size_t received = 0; received < items;){
+        const size_t popped = q.pop_n(buffer, group);
+        if(!popped) std::this_thread::yield();
+        for(size_t i = 0; i < popped; ++i) sum += buffer[i];
+        received += popped;
+    }
+    producer.join();
+    do_not_optimize(sum);
+}
+
+/**
+ * @brief Bounces a value between two threads through the queues ping and pong, rounds times.
+ */
+template<typename Q>
+void round_trips(Q& ping, Q& pong, size_t rounds){
+    std::thread echo([&]{
+        long long value;
+        for(size_t i = 0; i < rounds; ++i){
+            while(!ping.try_pop(value)) std::this_thread::yield();
+            while(!pong.try_push(value)) std::this_thread::yield();
+        }
+    });
+    long long value = 0;
+    for(size_t i = 0; i < rounds; ++i){
+        while(!ping.try_push(value)) std::this_thread::yield();
+        while(!pong.try_pop(value)) std::this_thread::yield();
+    }
+    echo.join();
+}
+
+int main(int argc, char** argv){
+    const size_t items = bench_size(argc, argv, 2000000);
+    const size_t rounds = items / 20;
+    constexpr size_t capacity = 1024;
+
+    bench_section("throughput, one producer and one consumer");
+    bench_run("spsc_ring_buffer try_push/try_pop", items, [&]{
+        spsc_ring_buffer<long long> q(capacity);
+        transfer(q, items, 1);
+    });
+    bench_run("spsc_ring_buffer push_n/pop_n (64)", items, [&]{
+        spsc_ring_buffer<long long> q(capacity);
+        transfer_batched(q, items);
+    });
+    bench_run("mpmc_ring_buffer try_push/try_pop", items, [&]{
+        mpmc_ring_buffer<long long> q(capacity);
+        transfer(q, items, 1);
+    });
+    bench_run("singly_linked_list queue", items, [&]{
+        list_queue q;
+        transfer(q, items, 1);
+    });
+
+    bench_section("throughput, two producers and two consumers");
+    bench_run("mpmc_ring_buffer try_push/try_pop", items, [&]{
+        mpmc_ring_buffer<long long> q(capacity);
+        transfer(q, items, 2);
+    });
+    bench_run("singly_linked_list queue", items, [&]{
+        list_queue q;
+        transfer(q, items, 2);
+    });
+
+    bench_section("round-trip latency between two threads (items are round trips)");
+    bench_run("spsc_ring_buffer", rounds, [&]{
+        spsc_ring_buffer<long long> ping(capacity), pong(capacity);
+        round_trips(ping, pong, rounds);
+    });
+    bench_run("mpmc_ring_buffer", rounds, [&]{
+        mpmc_ring_buffer<long long> ping(capacity), pong(capacity);
+        round_trips(ping, pong, rounds);
+    });
+    bench_run("singly_linked_list queue", rounds, [&]{
+        list_queue ping, pong;
+        round_trips(ping, pong, rounds);
+    });
+    return 0;
+}
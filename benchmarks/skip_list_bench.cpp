@@ -0,0 +1,98 @@
+#include <mutex>
+#include <thread>
+#include "bench.hpp"
+#include "../list/concurrent_skip_list/concurrent_skip_list.cpp"
+#include "../list/doubly_linked_list/doubly_linked_list.cpp"
+
+/*
+    @file skip_list_bench.cpp
+    @brief Mixed read/insert/erase workload on concurrent_skip_list against an ordered, locked doubly_linked_list.
+*/
+
+/**
+ * @brief Ordered set kept in a doubly_linked_list behind one mutex, i.e. what the lists offered before.
+ */
+struct locked_list_set{
+    doubly_linked_list<long long> list;
+    std::mutex mtx;
+
+    bool insert(const long long& value){
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = list.begin();
+        while(it != list.end() && *it < value) ++it;
+        if(it != list.end() && *it == value) return false;
+        list.insert(it, value);
+        return true;
+    }
+    bool erase(const long long& value){
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = list.begin();
+        while(it != list.end() && *it < value) ++it;
+        if(it == list.end() || *it != value) return false;
+        list.erase(it);
+        return true;
+    }
+    bool contains(const long long& value){
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = list.begin();
+        while(it != list.end() && *it < value) ++it;
+        return it != list.end() && *it == value;
+    }
+};
+
+/**
+ * @brief Runs ops operations per thread on set: 80% contains, 10% insert, 10% erase over keys in [0, key_range).
+ */
+template<typename Set>
+void mixed_workload(Set& set, size_t threads, size_t ops, size_t key_range){
+    std::thread* pool = new std::thread[threads];
+    for(size_t t = 0; t < threads; ++t){
+        pool[t] = std::thread([&set, ops, key_range, t]{
+            bench_rng rng(t + 1);
+            size_t hits = 0;
+            for(size_t i = 0; i < ops; ++i){
+                const unsigned long long r = rng.next();
+                const long long key = (long long)((r >> 8) % key_range);
+                const unsigned kind = r % 10;
+                if(kind == 0) hits += set.insert(key);
+                else if(kind == 1) hits += set.erase(key);
+                else hits += set.contains(key);
+            }
+            do_not_optimize(hits);
+        });
+    }
+    for(size_t t = 0; t < threads; ++t) pool[t].join();
+    delete[] pool;
+}
+
+/**
+ * @brief Fills set with every other key of [0, key_range), so that the workload starts half full.
+ */
+template<typename Set>
+void prefill(Set& set, size_t key_range){
+    for(size_t k = 0; k < key_range; k += 2) set.insert((long long)k);
+}
+
+int main(int argc, char** argv){
+    const size_t ops = bench_size(argc, argv, 100000);
+    const size_t threads = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 2;
+
+    for(size_t key_range : {size_t(256), size_t(4096)}){
+        char title[96];
+        std::snprintf(title, sizeof(title), "80%% contains, 10%% insert, 10%% erase, %zu keys, %zu threads", key_range, threads);
+        bench_section(title);
+
+        bench_run("concurrent_skip_list", threads * ops, [&]{
+            concurrent_skip_list<long long> set;
+            prefill(set, key_range);
+            mixed_workload(set, threads, ops, key_range);
+        });
+        // the list runs a tenth of the operations, since its O(n) scans would dominate the run
+        bench_run("doubly_linked_list + mutex", threads * ops / 10, [&]{
+            locked_list_set set;
+            prefill(set, key_range);
+            mixed_workload(set, threads, ops / 10, key_range);
+        });
+    }
+    return 0;
+}
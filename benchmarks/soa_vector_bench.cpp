@@ -0,0 +1,55 @@
+#include <array>
+#include "bench.hpp"
+#include "../vector/vector.cpp"
+#include "../vector/soa_vector.cpp"
+
+/*
+    @file soa_vector_bench.cpp
+    @brief Single-field scans over soa_vector columns against the same records stored in a vector<T>.
+*/
+
+struct record{
+    float x, y, z;
+    int id;
+    double weight;
+    char tag[16];
+};
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 4000000);
+
+    vector<record> aos;
+    soa_vector<float, float, float, int, double, std::array<char, 16>> soa(n);
+    bench_rng rng;
+    for(size_t i = 0; i < n; ++i){
+        const float x = float(rng.next() % 1000) / 10.f;
+        aos.push_back(record{x, 1.f, 2.f, int(i), 0.5, {}});
+        soa.push_back(x, 1.f, 2.f, int(i), 0.5, std::array<char, 16>{});
+    }
+
+    bench_section("sum of the x field");
+    bench_run("vector<record> iterator", n, [&]{
+        float sum = 0;
+        for(auto it = aos.begin(), end = aos.end(); it != end; ++it) sum += it->x;
+        do_not_optimize(sum);
+    });
+    bench_run("soa_vector column<0>() span", n, [&]{
+        float sum = 0;
+        for(float x : soa.column<0>()) sum += x;
+        do_not_optimize(sum);
+    });
+    bench_run("soa_vector iterator get<0>()", n, [&]{
+        float sum = 0;
+        for(auto it = soa.begin(), end = soa.end(); it != end; ++it) sum += (*it).get<0>();
+        do_not_optimize(sum);
+    });
+
+    bench_section("scale the weight field in place");
+    bench_run("vector<record> iterator", n, [&]{
+        for(auto it = aos.begin(), end = aos.end(); it != end; ++it) it->weight *= 1.0000001;
+    });
+    bench_run("soa_vector column<4>() span", n, [&]{
+        for(double& w : soa.column<4>()) w *= 1.0000001;
+    });
+    return 0;
+}
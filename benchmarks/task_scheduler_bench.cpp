@@ -0,0 +1,161 @@
+#include <atomic>
+#include <thread>
+#include "bench.hpp"
+#include "../scheduler/task_scheduler.cpp"
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+
+/*
+    @file task_scheduler_bench.cpp
+    @brief Fork/join benchmark of the work-stealing task_scheduler against a pool sharing one locked queue.
+*/
+
+/**
+ * @brief The single-queue approach: every worker pops jobs from one singly_linked_list behind its l_mutex.
+ * Waiting threads execute queued jobs, as task_group does, so nested fork/join cannot deadlock.
+ */
+class single_queue_pool{
+    public:
+        struct group{
+            std::atomic<size_t> pending{0};
+        };
+
+        explicit single_queue_pool(size_t workers) : stopping(false){
+            threads = new std::thread[workers];
+            count = workers;
+            for(size_t i = 0; i < workers; ++i){
+                threads[i] = std::thread([this]{
+                    while(!stopping.load(std::memory_order_relaxed)){
+                        if(!run_one()) std::this_thread::yield();
+                    }
+                });
+            }
+        }
+        ~single_queue_pool(){
+            stopping = true;
+            for(size_t i = 0; i < count; ++i) threads[i].join();
+            delete[] threads;
+        }
+
+        template<typename F>
+        void run(group& g, F f){
+            g.pending.fetch_add(1, std::memory_order_relaxed);
+            queue.push_back(new job{std::function<void()>(std::move(f)), &g});
+        }
+        void wait(group& g){
+            while(g.pending.load(std::memory_order_acquire) > 0){
+                if(!run_one()) std::this_thread::yield();
+            }
+        }
+
+    private:
+        struct job{
+            std::function<void()> fn;
+            group* owner;
+        };
+
+        bool run_one(){
+            job* j;
+            if(queue.pop_front_n(&j, 1) == 0) return false;
+            j->fn();
+            j->owner->pending.fetch_sub(1, std::memory_order_release);
+            delete j;
+            return true;
+        }
+
+        singly_linked_list<job*> queue;
+        std::thread* threads;
+        size_t count;
+        std::atomic<bool> stopping;
+};
+
+constexpr int fib_cutoff = 12;
+
+long long fib_serial(int n){
+    return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+long long fib_stealing(task_scheduler& s, int n){
+    if(n < fib_cutoff) return fib_serial(n);
+    long long a = 0;
+    task_scheduler::task_group g(s);
+    g.run([&]{ a = fib_stealing(s, n - 1); });
+    const long long b = fib_stealing(s, n - 2);
+    g.wait();
+    return a + b;
+}
+
+long long fib_single_queue(single_queue_pool& p, int n){
+    if(n < fib_cutoff) return fib_serial(n);
+    long long a = 0;
+    single_queue_pool::group g;
+    p.run(g, [&]{ a = fib_single_queue(p, n - 1); });
+    const long long b = fib_single_queue(p, n - 2);
+    p.wait(g);
+    return a + b;
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, 20000000);
+    const size_t workers = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 2;
+    const int fib_n = 30;
+    const size_t small_tasks = 200000;
+
+    task_scheduler s(workers);
+    single_queue_pool p(workers);
+
+    //fib_serial(n) makes 2 * fib(n + 1) - 1 calls
+    const size_t fib_calls = size_t(2 * fib_serial(fib_n + 1) - 1);
+
+    bench_section("parallel fib(30), one task per call above the cutoff (items are calls)");
+    bench_run("serial", fib_calls, [&]{ do_not_optimize(fib_serial(fib_n)); });
+    bench_run("task_scheduler", fib_calls, [&]{ do_not_optimize(fib_stealing(s, fib_n)); });
+    bench_run("single locked queue", fib_calls, [&]{ do_not_optimize(fib_single_queue(p, fib_n)); });
+
+    vector<long long> v(1, n);
+    const long long* data = &v[0];
+    const size_t pieces = workers * 8;
+
+    bench_section("parallel sum of a vector");
+    bench_run("serial", n, [&]{
+        long long total = 0;
+        for(size_t i = 0; i < n; ++i) total += data[i];
+        do_not_optimize(total);
+    });
+    bench_run("task_scheduler parallel_for over pieces", n, [&]{
+        std::atomic<long long> total{0};
+        s.parallel_for(0, pieces, [&](size_t piece){
+            long long partial = 0;
+            for(size_t i = piece * n / pieces; i < (piece + 1) * n / pieces; ++i) partial += data[i];
+            total += partial;
+        }, 1);
+        do_not_optimize(total.load());
+    });
+    bench_run("single locked queue over pieces", n, [&]{
+        std::atomic<long long> total{0};
+        single_queue_pool::group g;
+        for(size_t piece = 0; piece < pieces; ++piece){
+            p.run(g, [&, piece]{
+                long long partial = 0;
+                for(size_t i = piece * n / pieces; i < (piece + 1) * n / pieces; ++i) partial += data[i];
+                total += partial;
+            });
+        }
+        p.wait(g);
+        do_not_optimize(total.load());
+    });
+
+    bench_section("many tiny tasks");
+    bench_run("task_scheduler task_group", small_tasks, [&]{
+        std::atomic<size_t> done{0};
+        task_scheduler::task_group g(s);
+        for(size_t i = 0; i < small_tasks; ++i) g.run([&]{ done.fetch_add(1, std::memory_order_relaxed); });
+        g.wait();
+    });
+    bench_run("single locked queue", small_tasks, [&]{
+        std::atomic<size_t> done{0};
+        single_queue_pool::group g;
+        for(size_t i = 0; i < small_tasks; ++i) p.run(g, [&]{ done.fetch_add(1, std::memory_order_relaxed); });
+        p.wait(g);
+    });
+    return 0;
+}
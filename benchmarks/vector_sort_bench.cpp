@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include "bench.hpp"
+#include "../vector/vector_sort.cpp"
+
+/*
+    @file vector_sort_bench.cpp
+    @brief Benchmark of radix_sort, introsort and parallel_sort against std::sort, for 64 bit integer and double
+    keys drawn from random, sorted, reversed and few-unique distributions.
+*/
+
+/**
+ * @brief Fills keys with n values of the named distribution.
+ */
+template<typename T>
+void generate(T* keys, size_t n, const char* kind){
+    bench_rng rng;
+    for(size_t i = 0; i < n; ++i){
+        switch(kind[0]){
+            case 'r': keys[i] = kind[2] == 'n' ? T(rng.next() >> 12) : T(n - i); break; //random or reversed
+            case 's': keys[i] = T(i); break;                                             //sorted
+            default: keys[i] = T(rng.next() % 16); break;                                //few unique
+        }
+    }
+}
+
+/**
+ * @brief Sorts a fresh copy of input repeats times and reports the fastest sort; the copy is not timed.
+ */
+template<typename T, typename Sort>
+void measure(const char* name, const T* input, T* work, size_t n, Sort sort, int repeats = 3){
+    double best = std::numeric_limits<double>::max();
+    for(int r = 0; r < repeats; ++r){
+        std::memcpy(work, input, n * sizeof(T));
+        const bench_clock::time_point start = bench_clock::now();
+        sort(work, n);
+        const double elapsed = bench_seconds(start);
+        if(elapsed < best) best = elapsed;
+    }
+    if(!std::is_sorted(work, work + n)){
+        std::printf("%s did not sort the keys\n", name);
+        std::exit(1);
+    }
+    bench_report(name, n, best);
+}
+
+/**
+ * @brief Runs every sort over every distribution for keys of type T.
+ */
+template<typename T>
+void run_all(const char* type, size_t n, task_scheduler& s){
+    const char* kinds[] = {"random", "sorted", "reversed", "few unique (16 values)"};
+    T* input = new T[n];
+    T* work = new T[n];
+    char title[96];
+
+    for(const char* kind : kinds){
+        generate(input, n, kind);
+        std::snprintf(title, sizeof(title), "%s, %s", type, kind);
+        bench_section(title);
+        measure("std::sort", input, work, n, [](T* p, size_t m){ std::sort(p, p + m); });
+        measure("radix_sort", input, work, n, [](T* p, size_t m){ radix_sort(p, m); });
+        measure("introsort", input, work, n, [](T* p, size_t m){ introsort(p, m); });
+        measure("parallel_sort", input, work, n, [&](T* p, size_t m){ parallel_sort(p, m, s); });
+    }
+    delete[] input;
+    delete[] work;
+}
+
+int main(int argc, char** argv){
+    const size_t n = bench_size(argc, argv, size_t(1) << 23);
+    const size_t workers = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    task_scheduler s(workers);
+
+    run_all<uint64_t>("uint64_t", n, s);
+    run_all<double>("double", n, s);
+
+    //the vector overloads hold the batch lock and dispatch on the key type
+    bench_section("vector<uint64_t>, random");
+    vector<uint64_t> v;
+    double best = std::numeric_limits<double>::max();
+    for(int r = 0; r < 3; ++r){
+        v.clear();
+        bench_rng rng;
+        for(size_t i = 0; i < n; ++i) v.push_back(rng.next());
+        const bench_clock::time_point start = bench_clock::now();
+        vector_sort(v);
+        best = std::min(best, bench_seconds(start));
+    }
+    bench_report("vector_sort", n, best);
+    return 0;
+}
@@ -0,0 +1,260 @@
+#ifndef CHANNEL_CPP
+#define CHANNEL_CPP
+#include "channel.hpp"
+
+/*
+    @file channel.cpp
+    @brief The current cpp source file contains the actual implementation of the channel class.
+    Definitions are given in this file since it is a template class.
+*/
+
+/**
+ * @class send_awaiter
+ * @brief Awaitable returned by send: co_await yields true if the value was delivered, false if the channel is closed.
+ */
+template<typename T>
+class channel<T>::send_awaiter{
+    channel* ch;
+    waiter w;
+
+    public:
+        send_awaiter(channel* c, const T& value) : ch(c){
+            w.value.emplace(value);
+        }
+
+        bool await_ready() const noexcept{
+            return false;
+        }
+        bool await_suspend(std::coroutine_handle<> h){
+            std::unique_lock<std::mutex> lock(ch->mtx_);
+            if(!ch->closed && ch->receivers.empty() && ch->full()){
+                w.handle = h;
+                ch->senders.push_back(w);
+                return true;
+            }
+            std::coroutine_handle<> wake = ch->send_unlocked(w);
+            lock.unlock();
+            if(wake) ch->ex->schedule(wake);
+            return false;
+        }
+        bool await_resume() const noexcept{
+            return !w.closed;
+        }
+};
+
+/**
+ * @class receive_awaiter
+ * @brief Awaitable returned by receive: co_await yields the next value, or std::nullopt once the channel is closed and drained.
+ */
+template<typename T>
+class channel<T>::receive_awaiter{
+    channel* ch;
+    waiter w;
+
+    public:
+        explicit receive_awaiter(channel* c) : ch(c){};
+
+        bool await_ready() const noexcept{
+            return false;
+        }
+        bool await_suspend(std::coroutine_handle<> h){
+            std::unique_lock<std::mutex> lock(ch->mtx_);
+            if(!ch->closed && ch->buffer.empty() && ch->senders.empty()){
+                w.handle = h;
+                ch->receivers.push_back(w);
+                return true;
+            }
+            std::coroutine_handle<> wake = ch->receive_unlocked(w);
+            lock.unlock();
+            if(wake) ch->ex->schedule(wake);
+            return false;
+        }
+        std::optional<T> await_resume(){
+            return std::move(w.value);
+        }
+};
+
+/**
+ * @brief Constructor that creates an empty channel.
+ *
+ * @param e The executor on which suspended senders and receivers are resumed.
+ * @param capacity The maximum number of buffered values, 0 meaning unbounded.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+channel<T>::channel(executor& e, size_t capacity) : ex(&e), capacity(capacity){};
+
+template<typename T>
+bool channel<T>::full() const{
+    return capacity != 0 && buffer.get_size() >= capacity;
+};
+
+/**
+ * @brief Delivers the value of w to a waiting receiver or to the buffer; the caller holds mtx_ and checked there is room.
+ *
+ * @return The receiver to resume, if any.
+ */
+template<typename T>
+std::coroutine_handle<> channel<T>::send_unlocked(waiter& w){
+    if(closed){
+        w.closed = true;
+        return nullptr;
+    }
+    if(!receivers.empty()){
+        waiter& r = receivers.front();
+        receivers.pop_front();
+        r.value = std::move(w.value);
+        return r.handle;
+    }
+    buffer.push_back(*w.value);
+    w.value.reset();
+    return nullptr;
+};
+
+/**
+ * @brief Moves the next value into w, refilling the buffer from the first waiting sender; the caller holds mtx_.
+ *
+ * @return The sender to resume, if any.
+ */
+template<typename T>
+std::coroutine_handle<> channel<T>::receive_unlocked(waiter& w){
+    if(!buffer.empty()){
+        w.value.emplace(std::move(buffer.front()));
+        buffer.pop_front();
+    }
+    if(senders.empty()) return nullptr;
+
+    waiter& s = senders.front();
+    senders.pop_front();
+    if(w.value) buffer.push_back(*s.value);
+    else w.value = std::move(s.value);
+    s.value.reset();
+    return s.handle;
+};
+
+/**
+ * @brief Sends a copy of value: co_await ch.send(value) suspends while the channel is full.
+ *
+ * @param value The value to send.
+ * @return An awaitable yielding false if the channel was closed before the value could be delivered.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+typename channel<T>::send_awaiter channel<T>::send(const T& value){
+    return send_awaiter(this, value);
+};
+
+/**
+ * @brief Receives the next value: co_await ch.receive() suspends while the channel is empty and open.
+ *
+ * @return An awaitable yielding the value, or std::nullopt if the channel is closed and drained.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+typename channel<T>::receive_awaiter channel<T>::receive(){
+    return receive_awaiter(this);
+};
+
+/**
+ * @brief Sends a copy of value without suspending, for use outside coroutines.
+ *
+ * @param value The value to send.
+ * @return true if the value was delivered, false if the channel is full or closed.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+bool channel<T>::try_send(const T& value){
+    waiter w;
+    w.value.emplace(value);
+
+    std::unique_lock<std::mutex> lock(mtx_);
+    if(closed || (receivers.empty() && full())) return false;
+    std::coroutine_handle<> wake = send_unlocked(w);
+    lock.unlock();
+    if(wake) ex->schedule(wake);
+    return true;
+};
+
+/**
+ * @brief Receives the next value without suspending, for use outside coroutines.
+ *
+ * @return The value, or std::nullopt if the channel is empty.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+std::optional<T> channel<T>::try_receive(){
+    waiter w;
+
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::coroutine_handle<> wake = receive_unlocked(w);
+    lock.unlock();
+    if(wake) ex->schedule(wake);
+    return std::move(w.value);
+};
+
+/**
+ * @brief Closes the channel: pending and later sends fail, receives drain the buffer and then yield std::nullopt.
+ *
+ * Every suspended sender and receiver is resumed.
+ *
+ * @note the time complexity is O(w), where w is the number of suspended coroutines
+ */
+template<typename T>
+void channel<T>::close(){
+    deque<std::coroutine_handle<>> wake;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        closed = true;
+        while(!senders.empty()){
+            waiter& s = senders.front();
+            senders.pop_front();
+            s.closed = true;
+            wake.push_back(s.handle);
+        }
+        while(!receivers.empty()){
+            waiter& r = receivers.front();
+            receivers.pop_front();
+            wake.push_back(r.handle);
+        }
+    }
+    for(std::coroutine_handle<> h : wake) ex->schedule(h);
+};
+
+/**
+ * @brief Returns true if the channel is closed.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool channel<T>::is_closed() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return closed;
+};
+
+/**
+ * @brief Returns the number of buffered values.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t channel<T>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer.get_size();
+};
+
+/**
+ * @brief Returns the capacity of the channel, 0 meaning unbounded.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t channel<T>::get_capacity() const{
+    return capacity;
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef CHANNEL_HPP
+#define CHANNEL_HPP
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include "executor.cpp"
+#include "../deque/deque.cpp"
+#include "../list/intrusive_doubly_linked_list/intrusive_doubly_linked_list.cpp"
+
+/**
+ * @file channel.hpp
+ * @brief An awaitable multi-producer multi-consumer channel for C++20 coroutines.
+ *
+ * Values are buffered in a deque, while suspended senders and receivers wait in intrusive lists of awaiters living
+ * in their coroutine frames, so waiting allocates nothing. A send to a waiting receiver hands the value over
+ * directly; a receive from a full channel takes the oldest value and moves the first waiting sender's value into
+ * the freed slot. Resumed coroutines are scheduled on the channel's executor.
+ *
+ * @tparam T Type of the values.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class channel{
+    private:
+        struct waiter{
+            intrusive_dlist_hook<waiter> hook;
+            std::coroutine_handle<> handle;
+            std::optional<T> value;
+            bool closed = false;
+        };
+
+        executor* ex;
+        size_t capacity;
+        bool closed = false;
+        deque<T> buffer;
+        intrusive_doubly_linked_list<waiter, &waiter::hook> senders;
+        intrusive_doubly_linked_list<waiter, &waiter::hook> receivers;
+        mutable std::mutex mtx_;
+
+        bool full() const;
+        std::coroutine_handle<> send_unlocked(waiter& w);
+        std::coroutine_handle<> receive_unlocked(waiter& w);
+
+    public:
+        class send_awaiter;
+        class receive_awaiter;
+
+        explicit channel(executor& e, size_t capacity = 0);
+        channel(const channel& ch) = delete;
+        channel& operator=(const channel& ch) = delete;
+
+        send_awaiter send(const T& value);
+        receive_awaiter receive();
+        bool try_send(const T& value);
+        std::optional<T> try_receive();
+        void close();
+
+        bool is_closed() const;
+        size_t get_size() const;
+        size_t get_capacity() const;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef EXECUTOR_CPP
+#define EXECUTOR_CPP
+#include "executor.hpp"
+
+/*
+    @file executor.cpp
+    @brief The current cpp source file contains the actual implementation of the executors and of async_task.
+    The definitions are inline since the file is included wherever the executors are used.
+*/
+
+inline async_task async_task::promise_type::get_return_object(){
+    return async_task(std::coroutine_handle<promise_type>::from_promise(*this));
+};
+
+inline std::suspend_always async_task::promise_type::initial_suspend() noexcept{
+    return {};
+};
+
+inline std::suspend_never async_task::promise_type::final_suspend() noexcept{
+    return {};
+};
+
+inline void async_task::promise_type::return_void(){};
+
+inline void async_task::promise_type::unhandled_exception(){
+    std::terminate();
+};
+
+/**
+ * @brief Runs when the coroutine frame is destroyed, i.e. when the coroutine finishes.
+ */
+inline async_task::promise_type::~promise_type(){
+    if(owner) owner->finished();
+};
+
+inline async_task::async_task(std::coroutine_handle<promise_type> h) : handle(h){};
+
+inline async_task::async_task(async_task&& t) noexcept : handle(t.handle){
+    t.handle = nullptr;
+};
+
+/**
+ * @brief Destructor that destroys the coroutine if it was never spawned.
+ */
+inline async_task::~async_task(){
+    if(handle) handle.destroy();
+};
+
+/**
+ * @class yield_awaiter
+ * @brief Awaitable suspending the coroutine and scheduling it again at the back of the executor queue.
+ */
+class executor::yield_awaiter{
+    executor* owner;
+
+    public:
+        explicit yield_awaiter(executor* e) : owner(e){};
+
+        bool await_ready() const noexcept{
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> h){
+            owner->schedule(h);
+        }
+        void await_resume() const noexcept{}
+};
+
+/**
+ * @brief Starts a coroutine on the executor, which owns it from now on.
+ *
+ * @param t The coroutine, as returned by calling a function returning async_task.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void executor::spawn(async_task t){
+    std::coroutine_handle<async_task::promise_type> h = t.handle;
+    t.handle = nullptr;
+
+    h.promise().owner = this;
+    active.fetch_add(1);
+    schedule(h);
+};
+
+/**
+ * @brief Returns an awaitable letting the other scheduled coroutines run: co_await ex.yield().
+ *
+ * @note the time complexity is O(1)
+ */
+inline executor::yield_awaiter executor::yield(){
+    return yield_awaiter(this);
+};
+
+/**
+ * @brief Returns the number of spawned coroutines that did not finish yet.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t executor::get_active() const{
+    return active.load();
+};
+
+inline void executor::finished(){
+    active.fetch_sub(1);
+};
+
+/**
+ * @brief Queues h to be resumed by run(). May be called from any thread.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+inline void single_thread_executor::schedule(std::coroutine_handle<> h){
+    ready.push_back(h);
+};
+
+/**
+ * @brief Resumes the scheduled coroutines on the calling thread until none is ready.
+ *
+ * It returns when every coroutine finished or is suspended waiting for something that only another thread can
+ * provide; run() can then be called again.
+ *
+ * @return The number of resumptions performed.
+ *
+ * @note the time complexity is O(r), where r is the number of resumptions
+ */
+inline size_t single_thread_executor::run(){
+    size_t resumed = 0;
+
+    while(true){
+        std::coroutine_handle<> h;
+        {
+            deque<std::coroutine_handle<>>::batch b = ready.lock_batch();
+            if(b.empty()) break;
+            h = b[0];
+            b.pop_front();
+        }
+        h.resume();
+        ++resumed;
+    }
+
+    return resumed;
+};
+
+/**
+ * @brief Constructor that starts the worker threads.
+ *
+ * @param threads The number of threads, 0 meaning one per hardware thread.
+ *
+ * @note the time complexity is O(threads)
+ */
+inline thread_pool_executor::thread_pool_executor(size_t threads) : pool(threads){};
+
+/**
+ * @brief Queues h to be resumed by a worker. May be called from any thread.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+inline void thread_pool_executor::schedule(std::coroutine_handle<> h){
+    pool.submit([h]{ h.resume(); });
+};
+
+/**
+ * @brief Returns once every spawned coroutine finished, helping the workers meanwhile.
+ *
+ * It never returns if a coroutine stays suspended forever, e.g. receiving from a channel nobody sends to or closes.
+ */
+inline void thread_pool_executor::join(){
+    while(active.load() > 0){
+        if(!pool.run_one()) std::this_thread::yield();
+    }
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef EXECUTOR_HPP
+#define EXECUTOR_HPP
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include "../deque/deque.cpp"
+#include "../scheduler/task_scheduler.cpp"
+
+/**
+ * @file executor.hpp
+ * @brief Minimal coroutine executors: a single-threaded run loop and a multi-threaded pool.
+ *
+ * A coroutine returning async_task starts suspended and runs once spawned on an executor. Whenever it is resumed
+ * by a channel it is scheduled again on that executor, so thousands of coroutines blocked on channels take no
+ * thread at all and share the few threads of the executor.
+ *
+ * @author Andrea Maggetto
+ */
+
+class executor;
+
+/**
+ * @class async_task
+ * @brief Fire-and-forget coroutine type, started by executor::spawn and destroyed when it finishes.
+ *
+ * An exception escaping the coroutine terminates the program.
+ */
+class async_task{
+    public:
+        struct promise_type{
+            executor* owner = nullptr;
+
+            async_task get_return_object();
+            std::suspend_always initial_suspend() noexcept;
+            std::suspend_never final_suspend() noexcept;
+            void return_void();
+            void unhandled_exception();
+            ~promise_type();
+        };
+
+        async_task(async_task&& t) noexcept;
+        async_task(const async_task& t) = delete;
+        async_task& operator=(const async_task& t) = delete;
+        ~async_task();
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+        explicit async_task(std::coroutine_handle<promise_type> h);
+        friend class executor;
+};
+
+/**
+ * @class executor
+ * @brief Base class of the executors: something that resumes scheduled coroutines on its threads.
+ */
+class executor{
+    public:
+        class yield_awaiter;
+
+        virtual ~executor() = default;
+
+        virtual void schedule(std::coroutine_handle<> h) = 0;
+        void spawn(async_task t);
+        yield_awaiter yield();
+        size_t get_active() const;
+
+    protected:
+        std::atomic<size_t> active{0};
+
+    private:
+        void finished();
+        friend struct async_task::promise_type;
+};
+
+/**
+ * @class single_thread_executor
+ * @brief Executor resuming coroutines on the thread calling run(), one at a time.
+ */
+class single_thread_executor : public executor{
+    deque<std::coroutine_handle<>> ready;
+
+    public:
+        void schedule(std::coroutine_handle<> h) override;
+        size_t run();
+};
+
+/**
+ * @class thread_pool_executor
+ * @brief Executor resuming coroutines on the workers of a task_scheduler.
+ */
+class thread_pool_executor : public executor{
+    task_scheduler pool;
+
+    public:
+        explicit thread_pool_executor(size_t threads = 0);
+
+        void schedule(std::coroutine_handle<> h) override;
+        void join();
+};
+
+#endif
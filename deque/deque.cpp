@@ -0,0 +1,737 @@
+#ifndef DEQUE_CPP
+#define DEQUE_CPP
+#include "deque.hpp"
+
+/*
+    @file deque.cpp
+    @brief The current cpp source file contains the actual implementation of the deque class methods
+*/
+
+/**
+ * @brief Default constructor that initializes an empty deque. No memory is allocated until the first insertion.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>::deque() : map(nullptr), map_capacity(0), start(0), size(0){};
+
+/**
+ * @brief Copy constructor.
+ *
+ * @param d The deque to be copied.
+ *
+ * @note the time complexity is O(d.size)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>::deque(const deque& d) : map(nullptr), map_capacity(0), start(0), size(0){
+    std::lock_guard<std::mutex> lock(d.mtx_);
+    copy_from(d);
+};
+
+/**
+ * @brief Move constructor. The source deque is left empty.
+ *
+ * @param d The deque to be moved.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>::deque(deque&& d){
+    std::lock_guard<std::mutex> lock(d.mtx_);
+    map = d.map;
+    map_capacity = d.map_capacity;
+    start = d.start;
+    size = d.size;
+    d.map = nullptr;
+    d.map_capacity = d.start = d.size = 0;
+};
+
+/**
+ * @brief Destructor that destroys the elements and frees the blocks and the map.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>::~deque(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param d The deque to be copied.
+ * @return Reference to the modified deque.
+ *
+ * @note the time complexity is O(size + d.size)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>& deque<T, Alloc>::operator=(const deque& d){
+    if(this != &d){
+        std::lock(mtx_, d.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(d.mtx_, std::adopt_lock);
+
+        clean_up();
+        copy_from(d);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source deque is left empty.
+ *
+ * @param d The deque to be moved.
+ * @return Reference to the modified deque.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename T, typename Alloc>
+deque<T, Alloc>& deque<T, Alloc>::operator=(deque&& d) noexcept{
+    if(this != &d){
+        std::lock(mtx_, d.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(d.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        map = d.map;
+        map_capacity = d.map_capacity;
+        start = d.start;
+        size = d.size;
+
+        d.map = nullptr;
+        d.map_capacity = d.start = d.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Indexing operator, without bounds checking.
+ *
+ * @param index The position of the element, counted from the front.
+ * @return Reference to the element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+T& deque<T, Alloc>::operator[](const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return element(index);
+};
+
+/**
+ * @brief Const indexing operator, without bounds checking.
+ *
+ * @param index The position of the element, counted from the front.
+ * @return Const reference to the element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+const T& deque<T, Alloc>::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return element(index);
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @param index The position of the element, counted from the front.
+ * @return Reference to the element.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+T& deque<T, Alloc>::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return element(index);
+};
+
+/**
+ * @brief Accesses the first element.
+ *
+ * @return Reference to the first element.
+ * @throws std::out_of_range If the deque is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+T& deque<T, Alloc>::front() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return element(0);
+};
+
+/**
+ * @brief Accesses the last element.
+ *
+ * @return Reference to the last element.
+ * @throws std::out_of_range If the deque is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+T& deque<T, Alloc>::back() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return element(size - 1);
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @param d The deque to be compared.
+ * @return True if both deques hold equal elements in the same order.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename T, typename Alloc>
+bool deque<T, Alloc>::operator==(const deque& d) const{
+    if(this == &d) return true;
+
+    std::lock(mtx_, d.mtx_);
+    std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(d.mtx_, std::adopt_lock);
+
+    if(size != d.size) return false;
+    for(size_t i = 0; i < size; ++i){
+        if(element(i) != d.element(i)) return false;
+    }
+    return true;
+};
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @param d The deque to be compared.
+ * @return True if the deques differ.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename T, typename Alloc>
+bool deque<T, Alloc>::operator!=(const deque& d) const{
+    return !(*this == d);
+};
+
+/**
+ * @brief Appends an element at the back. No element is moved.
+ *
+ * @param el The element to be added.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::push_back(const T& el){
+    std::lock_guard<std::mutex> lock(mtx_);
+    push_back_unlocked(el);
+};
+
+/**
+ * @brief Prepends an element at the front. No element is moved.
+ *
+ * @param el The element to be added.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::push_front(const T& el){
+    std::lock_guard<std::mutex> lock(mtx_);
+    push_front_unlocked(el);
+};
+
+/**
+ * @brief Removes the last element.
+ *
+ * @throws std::out_of_range If the deque is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    pop_back_unlocked();
+};
+
+/**
+ * @brief Removes the first element.
+ *
+ * @throws std::out_of_range If the deque is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::pop_front(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    pop_front_unlocked();
+};
+
+/**
+ * @brief Locks the deque once and returns a handle exposing unlocked operations.
+ *
+ * The lock is held until the handle is destroyed. Using the deque directly from the same thread while the handle
+ * is alive deadlocks.
+ *
+ * @return The batch handle.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename deque<T, Alloc>::batch deque<T, Alloc>::lock_batch(){
+    return batch(*this);
+};
+
+/**
+ * @brief Destroys every element and frees the blocks. The map is kept for later insertions.
+ *
+ * @note the time complexity is O(size + map_capacity)
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    release_blocks();
+    if(map) start = (map_capacity / 2) * block_size;
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+size_t deque<T, Alloc>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Checks if the deque is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+bool deque<T, Alloc>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Random access iterator for the deque.
+ *
+ * It stores the deque and a position, so it is not invalidated by insertions at the back; insertions at the front
+ * shift the element it designates.
+ */
+template<typename T, typename Alloc>
+class deque<T, Alloc>::iterator{
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() : owner(nullptr), index(0){};
+        iterator(deque* d, size_t i) : owner(d), index(i){};
+
+        reference operator*() const{
+            return owner->element(index);
+        }
+        pointer operator->() const{
+            return &owner->element(index);
+        }
+        reference operator[](difference_type n) const{
+            return owner->element(index + n);
+        }
+
+        iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        iterator operator++(int){
+            iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        iterator& operator--(){
+            --index;
+            return *this;
+        }
+        iterator operator--(int){
+            iterator temp = *this;
+            --index;
+            return temp;
+        }
+        iterator& operator+=(difference_type n){
+            index += n;
+            return *this;
+        }
+        iterator& operator-=(difference_type n){
+            index -= n;
+            return *this;
+        }
+        iterator operator+(difference_type n) const{
+            return iterator(owner, index + n);
+        }
+        iterator operator-(difference_type n) const{
+            return iterator(owner, index - n);
+        }
+        difference_type operator-(const iterator& other) const{
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const iterator& other) const{
+            return index != other.index;
+        }
+        bool operator<(const iterator& other) const{
+            return index < other.index;
+        }
+        bool operator>(const iterator& other) const{
+            return index > other.index;
+        }
+        bool operator<=(const iterator& other) const{
+            return index <= other.index;
+        }
+        bool operator>=(const iterator& other) const{
+            return index >= other.index;
+        }
+        friend iterator operator+(difference_type n, const iterator& it){
+            return it + n;
+        }
+
+    private:
+        deque* owner;
+        size_t index;
+
+        friend class const_iterator;
+};
+
+/**
+ * @brief Constant random access iterator for the deque.
+ */
+template<typename T, typename Alloc>
+class deque<T, Alloc>::const_iterator{
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : owner(nullptr), index(0){};
+        const_iterator(const deque* d, size_t i) : owner(d), index(i){};
+        const_iterator(const iterator& it) : owner(it.owner), index(it.index){};
+
+        reference operator*() const{
+            return owner->element(index);
+        }
+        pointer operator->() const{
+            return &owner->element(index);
+        }
+        reference operator[](difference_type n) const{
+            return owner->element(index + n);
+        }
+
+        const_iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        const_iterator& operator--(){
+            --index;
+            return *this;
+        }
+        const_iterator operator--(int){
+            const_iterator temp = *this;
+            --index;
+            return temp;
+        }
+        const_iterator& operator+=(difference_type n){
+            index += n;
+            return *this;
+        }
+        const_iterator& operator-=(difference_type n){
+            index -= n;
+            return *this;
+        }
+        const_iterator operator+(difference_type n) const{
+            return const_iterator(owner, index + n);
+        }
+        const_iterator operator-(difference_type n) const{
+            return const_iterator(owner, index - n);
+        }
+        difference_type operator-(const const_iterator& other) const{
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const const_iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const{
+            return index != other.index;
+        }
+        bool operator<(const const_iterator& other) const{
+            return index < other.index;
+        }
+        bool operator>(const const_iterator& other) const{
+            return index > other.index;
+        }
+        bool operator<=(const const_iterator& other) const{
+            return index <= other.index;
+        }
+        bool operator>=(const const_iterator& other) const{
+            return index >= other.index;
+        }
+        friend const_iterator operator+(difference_type n, const const_iterator& it){
+            return it + n;
+        }
+
+    private:
+        const deque* owner;
+        size_t index;
+};
+
+/**
+ * @brief Scoped batch handle for the deque.
+ *
+ * Holds the deque lock for its whole lifetime and exposes the common operations without any further locking.
+ */
+template<typename T, typename Alloc>
+class deque<T, Alloc>::batch{
+    public:
+        explicit batch(deque& d) : owner(&d), lock(d.mtx_){};
+
+        void push_back(const T& el){
+            owner->push_back_unlocked(el);
+        }
+        void push_front(const T& el){
+            owner->push_front_unlocked(el);
+        }
+        void pop_back(){
+            if(owner->size == 0) throw std::out_of_range("Out of range!");
+            owner->pop_back_unlocked();
+        }
+        void pop_front(){
+            if(owner->size == 0) throw std::out_of_range("Out of range!");
+            owner->pop_front_unlocked();
+        }
+        T& operator[](const size_t index){
+            return owner->element(index);
+        }
+        size_t get_size() const{
+            return owner->size;
+        }
+        bool empty() const{
+            return owner->size == 0;
+        }
+
+    private:
+        deque* owner;
+        std::unique_lock<std::mutex> lock;
+};
+
+/**
+ * @brief Creates an iterator pointing to the first element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename deque<T, Alloc>::iterator deque<T, Alloc>::begin(){
+    return iterator(this, 0);
+};
+
+/**
+ * @brief Creates an iterator pointing past the last element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename deque<T, Alloc>::iterator deque<T, Alloc>::end(){
+    return iterator(this, size);
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the first element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename deque<T, Alloc>::const_iterator deque<T, Alloc>::begin() const{
+    return const_iterator(this, 0);
+};
+
+/**
+ * @brief Creates a constant iterator pointing past the last element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename deque<T, Alloc>::const_iterator deque<T, Alloc>::end() const{
+    return const_iterator(this, size);
+};
+
+/**
+ * @brief Returns the element at index without locking. The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+T& deque<T, Alloc>::element(size_t index) const{
+    const size_t position = start + index;
+    return map[position / block_size][position % block_size];
+};
+
+/**
+ * @brief Returns the storage at an absolute position of the map, allocating its block if needed.
+ * The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+T* deque<T, Alloc>::slot(size_t position){
+    T*& block = map[position / block_size];
+    if(!block) block = alloc.allocate(block_size);
+    return block + position % block_size;
+};
+
+/**
+ * @brief Makes room for at least one more block at both ends of the map.
+ *
+ * The allocated blocks are moved, as pointers, to the middle of the map: in place if the map is less than half
+ * full, otherwise into a new map twice as large. The elements never move. The caller must hold mtx_.
+ *
+ * @note the time complexity is O(map_capacity), amortized O(1) per insertion
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::remap(){
+    const size_t first = start / block_size;
+    const size_t last = (start + size + block_size - 1) / block_size;
+    const size_t live = last - first;
+
+    size_t new_capacity = map_capacity;
+    T** new_map = map;
+
+    if(map_capacity < 2 * live + 2){
+        new_capacity = map_capacity * 2;
+        if(new_capacity < 2 * live + 2) new_capacity = 2 * live + 2;
+        if(new_capacity < min_map_capacity) new_capacity = min_map_capacity;
+
+        new_map = map_alloc.allocate(new_capacity);
+    }
+
+    const size_t new_first = (new_capacity - live) / 2;
+
+    if(new_map == map){
+        if(new_first < first){
+            for(size_t i = 0; i < live; ++i) new_map[new_first + i] = map[first + i];
+        }
+        else{
+            for(size_t i = live; i > 0; --i) new_map[new_first + i - 1] = map[first + i - 1];
+        }
+        for(size_t i = 0; i < new_first; ++i) new_map[i] = nullptr;
+        for(size_t i = new_first + live; i < new_capacity; ++i) new_map[i] = nullptr;
+    }
+    else{
+        for(size_t i = 0; i < new_capacity; ++i) new_map[i] = nullptr;
+        for(size_t i = 0; i < live; ++i) new_map[new_first + i] = map[first + i];
+        if(map) map_alloc.deallocate(map, map_capacity);
+    }
+
+    start = start - first * block_size + new_first * block_size;
+    map = new_map;
+    map_capacity = new_capacity;
+};
+
+/**
+ * @brief Appends an element without locking. The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::push_back_unlocked(const T& el){
+    if(start + size == map_capacity * block_size) remap();
+    new (slot(start + size)) T(el);
+    ++size;
+};
+
+/**
+ * @brief Prepends an element without locking. The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::push_front_unlocked(const T& el){
+    if(start == 0) remap();
+    new (slot(start - 1)) T(el);
+    --start;
+    ++size;
+};
+
+/**
+ * @brief Removes the last element without locking, freeing its block when it becomes empty.
+ * The deque must not be empty and the caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::pop_back_unlocked(){
+    const size_t position = start + size - 1;
+    T*& block = map[position / block_size];
+
+    block[position % block_size].~T();
+    --size;
+
+    if(position % block_size == 0){
+        alloc.deallocate(block, block_size);
+        block = nullptr;
+    }
+};
+
+/**
+ * @brief Removes the first element without locking, freeing its block when it becomes empty.
+ * The deque must not be empty and the caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::pop_front_unlocked(){
+    T*& block = map[start / block_size];
+
+    block[start % block_size].~T();
+    ++start;
+    --size;
+
+    if(start % block_size == 0){
+        alloc.deallocate(block, block_size);
+        block = nullptr;
+    }
+};
+
+/**
+ * @brief Destroys every element and frees every block still referenced by the map, including partly used blocks
+ * left around the live range. The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void deque<T, Alloc>::release_blocks(){
+    while(size > 0) pop_back_unlocked();
+
+    for(size_t i = 0; i < map_capacity; ++i){
+        if(map[i]){
+            alloc.deallocate(map[i], block_size);
+            map[i] = nullptr;
+        }
+    }
+};
+
+template<typename T, typename Alloc>
+void deque<T, Alloc>::clean_up(){
+    release_blocks();
+    if(map) map_alloc.deallocate(map, map_capacity);
+
+    map = nullptr;
+    map_capacity = start = 0;
+};
+
+template<typename T, typename Alloc>
+void deque<T, Alloc>::copy_from(const deque& d){
+    for(size_t i = 0; i < d.size; ++i) push_back_unlocked(d.element(i));
+};
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file deque.hpp
+ * @brief Custom templated, thread-safe double-ended queue made of fixed-size blocks.
+ *
+ * The elements live in blocks of block_size elements obtained from Alloc, and a map of block pointers keeps the
+ * blocks in order. Element i is found with one division and two loads, so indexing is O(1) like in vector, while
+ * push_front, push_back, pop_front and pop_back are O(1): they never move elements, only the map of pointers is
+ * reallocated (or recentered) when one of its ends is reached. As a consequence, references to elements stay
+ * valid across insertions and removals at either end, except for the removed elements themselves.
+ *
+ * As in vector, every operation locks the deque and lock_batch gives a handle running many operations under a
+ * single lock acquisition.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T, typename Alloc = allocator<T>>
+class deque{
+    public:
+        class iterator;
+        class const_iterator;
+        class batch;
+
+    private:
+        static constexpr size_t block_size = sizeof(T) <= 256 ? 4096 / sizeof(T) : 16;
+        static constexpr size_t min_map_capacity = 8;
+
+        using map_allocator = typename Alloc::template rebind<T*>::other;
+
+        T** map;
+        size_t map_capacity, start, size;
+        Alloc alloc;
+        map_allocator map_alloc;
+        mutable std::mutex mtx_;
+
+        T& element(size_t index) const;
+        T* slot(size_t position);
+        void remap();
+        void push_back_unlocked(const T& el);
+        void push_front_unlocked(const T& el);
+        void pop_back_unlocked();
+        void pop_front_unlocked();
+        void release_blocks();
+        void clean_up();
+        void copy_from(const deque& d);
+
+    public:
+        deque();
+        deque(const deque& d);
+        deque(deque&& d);
+        ~deque();
+
+        deque& operator=(const deque& d);
+        deque& operator=(deque&& d) noexcept;
+
+        T& operator[](const size_t index);
+        const T& operator[](const size_t index) const;
+        T& at(const size_t index) const;
+        T& front() const;
+        T& back() const;
+
+        bool operator==(const deque& d) const;
+        bool operator!=(const deque& d) const;
+
+        void push_back(const T& el);
+        void push_front(const T& el);
+        void pop_back();
+        void pop_front();
+        batch lock_batch();
+        void clear();
+
+        size_t get_size() const;
+        bool empty() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
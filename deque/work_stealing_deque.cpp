@@ -0,0 +1,146 @@
+#ifndef WORK_STEALING_DEQUE_CPP
+#define WORK_STEALING_DEQUE_CPP
+#include "work_stealing_deque.hpp"
+
+/*
+    @file work_stealing_deque.cpp
+    @brief The current cpp source file contains the actual implementation of the work_stealing_deque class methods
+*/
+
+template<typename T>
+work_stealing_deque<T>::ring::ring(int64_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]){};
+
+template<typename T>
+T work_stealing_deque<T>::ring::get(int64_t index) const{
+    return slots[index & mask].load(std::memory_order_relaxed);
+};
+
+template<typename T>
+void work_stealing_deque<T>::ring::put(int64_t index, const T& value){
+    slots[index & mask].store(value, std::memory_order_relaxed);
+};
+
+/**
+ * @brief Constructor that allocates the circular array, rounding min_capacity up to a power of two.
+ *
+ * @param min_capacity The number of elements that fit before the first growth.
+ *
+ * @note the time complexity is O(min_capacity)
+ */
+template<typename T>
+work_stealing_deque<T>::work_stealing_deque(size_t min_capacity) : top(0), bottom(0){
+    int64_t capacity = 1;
+    while(capacity < static_cast<int64_t>(min_capacity)) capacity <<= 1;
+
+    rings.emplace_back(new ring(capacity));
+    array.store(rings.back().get(), std::memory_order_relaxed);
+};
+
+/**
+ * @brief Pushes an element at the bottom. Only the owner thread may call it.
+ *
+ * @param el The element to be pushed.
+ *
+ * @note the time complexity is O(1) amortized, wait-free unless the array grows
+ */
+template<typename T>
+void work_stealing_deque<T>::push(const T& el){
+    const int64_t b = bottom.load(std::memory_order_relaxed);
+    const int64_t t = top.load(std::memory_order_acquire);
+    ring* a = array.load(std::memory_order_relaxed);
+
+    if(b - t > a->mask) a = grow(a, b, t);
+
+    a->put(b, el);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+};
+
+/**
+ * @brief Pops the most recently pushed element. Only the owner thread may call it.
+ *
+ * @param out Receives the element.
+ * @return False if the deque was empty, or if a thief took the last element first.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool work_stealing_deque<T>::pop(T& out){
+    const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    ring* a = array.load(std::memory_order_relaxed);
+
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if(t > b){
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    out = a->get(b);
+    if(t == b){
+        //last element: race the thieves for it
+        const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+};
+
+/**
+ * @brief Steals the least recently pushed element. Any thread may call it.
+ *
+ * @param out Receives the element.
+ * @return False if the deque was empty or another thread claimed the element first.
+ *
+ * @note the time complexity is O(1), lock-free
+ */
+template<typename T>
+bool work_stealing_deque<T>::steal(T& out){
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom.load(std::memory_order_acquire);
+
+    if(t >= b) return false;
+
+    ring* a = array.load(std::memory_order_acquire);
+    const T el = a->get(t);
+    if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return false;
+
+    out = el;
+    return true;
+};
+
+/**
+ * @brief Returns the number of elements, exact only when no other thread is operating.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t work_stealing_deque<T>::get_size() const{
+    const int64_t b = bottom.load(std::memory_order_relaxed);
+    const int64_t t = top.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+};
+
+template<typename T>
+bool work_stealing_deque<T>::empty() const{
+    return get_size() == 0;
+};
+
+/**
+ * @brief Copies the live elements [t, b) into an array twice as large and publishes it. Only the owner calls it.
+ */
+template<typename T>
+typename work_stealing_deque<T>::ring* work_stealing_deque<T>::grow(ring* old, int64_t b, int64_t t){
+    ring* bigger = new ring((old->mask + 1) * 2);
+    rings.emplace_back(bigger);
+
+    for(int64_t i = t; i < b; ++i) bigger->put(i, old->get(i));
+    array.store(bigger, std::memory_order_release);
+
+    return bigger;
+};
+
+#endif
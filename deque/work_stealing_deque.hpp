@@ -0,0 +1,58 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file work_stealing_deque.hpp
+ * @brief Lock-free Chase-Lev work-stealing deque.
+ *
+ * One owner thread pushes and pops at the bottom, like a stack, while any number of thief threads steal from the
+ * top. Owner operations touch only the bottom index and synchronize with thieves only when at most one element is
+ * left; thieves claim the top element with a single CAS. The elements live in a circular array of atomics that the
+ * owner doubles when it is full; the replaced arrays are kept until the deque is destroyed, since a thief may still
+ * be reading them.
+ *
+ * @tparam T Type of the elements, trivially copyable (typically a pointer to a task).
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class work_stealing_deque{
+    static_assert(std::is_trivially_copyable<T>::value, "work_stealing_deque requires a trivially copyable T");
+
+    struct ring{
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit ring(int64_t capacity);
+        T get(int64_t index) const;
+        void put(int64_t index, const T& value);
+    };
+
+    alignas(64) std::atomic<int64_t> top;
+    alignas(64) std::atomic<int64_t> bottom;
+    std::atomic<ring*> array;
+    std::vector<std::unique_ptr<ring>> rings;
+
+    ring* grow(ring* old, int64_t b, int64_t t);
+
+    public:
+        explicit work_stealing_deque(size_t min_capacity = 64);
+        work_stealing_deque(const work_stealing_deque<T>& d) = delete;
+        work_stealing_deque<T>& operator=(const work_stealing_deque<T>& d) = delete;
+
+        void push(const T& el);
+        bool pop(T& out);
+        bool steal(T& out);
+
+        size_t get_size() const;
+        bool empty() const;
+};
+
+#endif
@@ -0,0 +1,170 @@
+#include "concurrent_hash_map.hpp"
+
+/*
+    @file concurrent_hash_map.cpp
+    @brief The current cpp source file contains the actual implementation of the concurrent_hash_map class methods
+*/
+
+/**
+ * @brief Returns the shard owning key together with the mixed hash of key.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q>
+std::pair<typename concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::shard_map*, size_t> concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::locate(const Q& key) const{
+    const size_t hash = shards[0].map.hash_of(key);
+    const size_t stripe = hash >> (sizeof(size_t) * 8 - stripe_bits);
+    return {const_cast<shard_map*>(&shards[stripe].map), hash};
+};
+
+/**
+ * @brief Constructor that sizes every stripe for its share of expected elements.
+ * 
+ * @note the time complexity is O(expected)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::concurrent_hash_map(size_t expected){
+    for(shard& s : shards) s.map.reserve(expected / stripes + 1);
+};
+
+/**
+ * @brief Inserts the pair if key is not already present. Only the stripe of key is locked.
+ *
+ * @return True if the pair was inserted.
+ * 
+ * @note the time complexity is O(1) amortized
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::insert(const K& key, const V& value){
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+    return map->insert_hashed(key, value, hash, false);
+};
+
+/**
+ * @brief Inserts the pair, or replaces the value if key is already present. Only the stripe of key is locked.
+ *
+ * @return True if a new pair was inserted.
+ * 
+ * @note the time complexity is O(1) amortized
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::insert_or_assign(const K& key, const V& value){
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+    return map->insert_hashed(key, value, hash, true);
+};
+
+/**
+ * @brief Removes the pair with the given key if present. Only the stripe of key is locked.
+ *
+ * @return True if a pair was removed.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::erase(const K& key){
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+    return map->erase_hashed(map->find_index(key, hash));
+};
+
+/**
+ * @brief Returns a copy of the value mapped to key, or an empty optional if the key is not present.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+std::optional<V> concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::get(const K& key) const{
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+
+    const size_t index = map->find_index(key, hash);
+    if(index == shard_map::npos) return std::nullopt;
+    return map->slots[index].second;
+};
+
+/**
+ * @brief Checks whether key is present.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::contains(const K& key) const{
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+    return map->find_index(key, hash) != shard_map::npos;
+};
+
+/**
+ * @brief Heterogeneous lookup, available when Hash and KeyEqual are transparent.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+std::optional<V> concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::get(const Q& key) const{
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+
+    const size_t index = map->find_index(key, hash);
+    if(index == shard_map::npos) return std::nullopt;
+    return map->slots[index].second;
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::contains(const Q& key) const{
+    auto [map, hash] = locate(key);
+    std::lock_guard<std::mutex> lock(map->mtx_);
+    return map->find_index(key, hash) != shard_map::npos;
+};
+
+/**
+ * @brief Removes every pair, one stripe at a time.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::clear(){
+    for(shard& s : shards) s.map.clear();
+};
+
+/**
+ * @brief Calls f on every pair, holding the lock of one stripe at a time. f must not use the map.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename F>
+void concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::for_each(F f) const{
+    for(const shard& s : shards){
+        std::lock_guard<std::mutex> lock(s.map.mtx_);
+        for(size_t i = 0; i < s.map.capacity; ++i){
+            if(s.map.ctrl[i] >= 0) f(static_cast<const value_type&>(s.map.slots[i]));
+        }
+    }
+};
+
+/**
+ * @brief Returns the number of pairs, summed stripe by stripe.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+size_t concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::get_size() const{
+    size_t total = 0;
+    for(const shard& s : shards) total += s.map.get_size();
+    return total;
+};
+
+/**
+ * @brief Checks if the map is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool concurrent_hash_map<K, V, Hash, KeyEqual, Alloc>::empty() const{
+    return get_size() == 0;
+};
@@ -0,0 +1,59 @@
+#ifndef CONCURRENT_HASH_MAP_HPP
+#define CONCURRENT_HASH_MAP_HPP
+#include "hash_map.cpp"
+
+/**
+ * @file concurrent_hash_map.hpp
+ * @brief Lock-striped variant of hash_map for many concurrent writers.
+ *
+ * The keys are spread over 64 independent hash_map shards by the top bits of their mixed hash, and each shard
+ * is protected by its own mutex, so operations on different stripes never contend. The hash is computed once
+ * and reused inside the shard. Single-key operations are linearizable like those of hash_map; get_size and
+ * for_each visit the stripes one at a time and are therefore not a snapshot of the whole map.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Alloc = allocator<std::pair<K, V>>>
+class concurrent_hash_map{
+    using shard_map = hash_map<K, V, Hash, KeyEqual, Alloc>;
+
+    static constexpr size_t stripe_bits = 6;
+    static constexpr size_t stripes = size_t(1) << stripe_bits;
+
+    struct alignas(64) shard{
+        shard_map map;
+    };
+
+    shard shards[stripes];
+
+    template<typename Q>
+    std::pair<shard_map*, size_t> locate(const Q& key) const;
+
+    public:
+        using value_type = std::pair<K, V>;
+
+        concurrent_hash_map() = default;
+        explicit concurrent_hash_map(size_t expected);
+        concurrent_hash_map(const concurrent_hash_map& m) = delete;
+        concurrent_hash_map& operator=(const concurrent_hash_map& m) = delete;
+
+        bool insert(const K& key, const V& value);
+        bool insert_or_assign(const K& key, const V& value);
+        bool erase(const K& key);
+        std::optional<V> get(const K& key) const;
+        bool contains(const K& key) const;
+        void clear();
+
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = typename shard_map::template if_transparent<Q, H, E>>
+        std::optional<V> get(const Q& key) const;
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = typename shard_map::template if_transparent<Q, H, E>>
+        bool contains(const Q& key) const;
+
+        template<typename F>
+        void for_each(F f) const;
+        size_t get_size() const;
+        bool empty() const;
+};
+
+#endif
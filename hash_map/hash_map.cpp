@@ -0,0 +1,701 @@
+#ifndef HASH_MAP_CPP
+#define HASH_MAP_CPP
+#include "hash_map.hpp"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+    @file hash_map.cpp
+    @brief The current cpp source file contains the actual implementation of the hash_map class methods
+*/
+
+/**
+ * @brief Sixteen consecutive control bytes, matched all at once.
+ *
+ * Every match returns a bit mask where bit i is set when the i-th control byte of the group matches.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+struct hash_map<K, V, Hash, KeyEqual, Alloc>::control_group{
+#ifdef __SSE2__
+    __m128i bytes;
+
+    explicit control_group(const int8_t* position) : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position))){}
+
+    uint32_t match(int8_t tag) const{
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(tag))));
+    }
+    uint32_t match_empty() const{
+        return match(ctrl_empty);
+    }
+    uint32_t match_empty_or_deleted() const{
+        //full slots hold a 7 bit tag, so the sign bit is set only for empty and deleted ones
+        return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+    }
+#else
+    const int8_t* bytes;
+
+    explicit control_group(const int8_t* position) : bytes(position){}
+
+    uint32_t match(int8_t tag) const{
+        uint32_t mask = 0;
+        for(size_t i = 0; i < group_width; ++i) mask |= static_cast<uint32_t>(bytes[i] == tag) << i;
+        return mask;
+    }
+    uint32_t match_empty() const{
+        return match(ctrl_empty);
+    }
+    uint32_t match_empty_or_deleted() const{
+        uint32_t mask = 0;
+        for(size_t i = 0; i < group_width; ++i) mask |= static_cast<uint32_t>(bytes[i] < 0) << i;
+        return mask;
+    }
+#endif
+};
+
+/**
+ * @brief Hashes key and mixes the result, so that weak hashes (e.g. the identity std::hash of integers)
+ * still spread over both the probe position and the 7 bit tag.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q>
+size_t hash_map<K, V, Hash, KeyEqual, Alloc>::hash_of(const Q& key) const{
+    uint64_t h = static_cast<uint64_t>(hasher(key));
+    h ^= h >> 32;
+    h *= 0x9E3779B97F4A7C15ull;
+    h ^= h >> 29;
+    return static_cast<size_t>(h);
+};
+
+/**
+ * @brief Returns the slot holding key, or npos. The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q>
+size_t hash_map<K, V, Hash, KeyEqual, Alloc>::find_index(const Q& key, size_t hash) const{
+    const size_t mask = capacity - 1;
+    const int8_t tag = static_cast<int8_t>(hash & 0x7F);
+    size_t position = (hash >> 7) & mask;
+
+    for(size_t step = group_width; ; position = (position + step) & mask, step += group_width){
+        control_group group(ctrl + position);
+
+        for(uint32_t bits = group.match(tag); bits != 0; bits &= bits - 1){
+            const size_t index = (position + __builtin_ctz(bits)) & mask;
+            if(eq(slots[index].first, key)) return index;
+        }
+        if(group.match_empty()) return npos;
+    }
+};
+
+/**
+ * @brief Returns the first empty or deleted slot of the probe sequence of hash. The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+size_t hash_map<K, V, Hash, KeyEqual, Alloc>::find_insert_slot(size_t hash) const{
+    const size_t mask = capacity - 1;
+    size_t position = (hash >> 7) & mask;
+
+    for(size_t step = group_width; ; position = (position + step) & mask, step += group_width){
+        uint32_t bits = control_group(ctrl + position).match_empty_or_deleted();
+        if(bits) return (position + __builtin_ctz(bits)) & mask;
+    }
+};
+
+/**
+ * @brief Writes a control byte, mirroring the first group after the end of the table so that groups can be
+ * loaded at any position without wrapping.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::set_ctrl(size_t index, int8_t code){
+    ctrl[index] = code;
+    if(index < group_width) ctrl[capacity + index] = code;
+};
+
+/**
+ * @brief Allocates an empty table of new_capacity slots, which must be a power of two.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::allocate_table(size_t new_capacity){
+    ctrl_storage = vector<int8_t>(ctrl_empty, new_capacity + group_width);
+    ctrl = &*ctrl_storage.begin();
+    slots = alloc.allocate(new_capacity);
+    capacity = new_capacity;
+    size = 0;
+    growth_left = new_capacity - new_capacity / 8;
+};
+
+/**
+ * @brief Moves every element into a new table of new_capacity slots, dropping the deleted markers.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::rehash(size_t new_capacity){
+    vector<int8_t> old_ctrl_storage = std::move(ctrl_storage);
+    const int8_t* old_ctrl = ctrl;
+    value_type* old_slots = slots;
+    const size_t old_capacity = capacity;
+
+    allocate_table(new_capacity);
+
+    for(size_t i = 0; i < old_capacity; ++i){
+        if(old_ctrl[i] < 0) continue;
+
+        const size_t hash = hash_of(old_slots[i].first);
+        const size_t index = find_insert_slot(hash);
+        new (slots + index) value_type(std::move(old_slots[i]));
+        old_slots[i].~value_type();
+        set_ctrl(index, static_cast<int8_t>(hash & 0x7F));
+        ++size;
+        --growth_left;
+    }
+
+    alloc.deallocate(old_slots, old_capacity);
+};
+
+/**
+ * @brief Inserts the pair or, when assign is set, overwrites the value of an existing key. The caller must hold mtx_.
+ * 
+ * @return True if a new pair was inserted.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename KArg, typename VArg>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::insert_hashed(KArg&& key, VArg&& value, size_t hash, bool assign){
+    size_t index = find_index(key, hash);
+    if(index != npos){
+        if(assign) slots[index].second = std::forward<VArg>(value);
+        return false;
+    }
+
+    if(growth_left == 0){
+        //a table full of deleted markers is cleaned in place instead of doubling
+        rehash(size * 2 < capacity - capacity / 8 ? capacity : capacity * 2);
+    }
+
+    index = find_insert_slot(hash);
+    if(ctrl[index] == ctrl_empty) --growth_left;
+
+    new (slots + index) value_type(std::forward<KArg>(key), std::forward<VArg>(value));
+    set_ctrl(index, static_cast<int8_t>(hash & 0x7F));
+    ++size;
+
+    return true;
+};
+
+/**
+ * @brief Destroys the element in slot index and marks it deleted. The caller must hold mtx_.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::erase_hashed(size_t index){
+    if(index == npos) return false;
+
+    slots[index].~value_type();
+    set_ctrl(index, ctrl_deleted);
+    --size;
+
+    return true;
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::clean_up(){
+    if(!slots) return;
+
+    for(size_t i = 0; i < capacity; ++i){
+        if(ctrl[i] >= 0) slots[i].~value_type();
+    }
+    alloc.deallocate(slots, capacity);
+
+    slots = nullptr;
+    ctrl = nullptr;
+    capacity = size = growth_left = 0;
+};
+
+/**
+ * @brief Destroys every element and marks every slot empty, keeping the table. The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::destroy_elements(){
+    for(size_t i = 0; i < capacity; ++i){
+        if(ctrl[i] >= 0) slots[i].~value_type();
+    }
+    std::fill(ctrl, ctrl + capacity + group_width, ctrl_empty);
+    size = 0;
+    growth_left = capacity - capacity / 8;
+};
+
+/**
+ * @brief Exchanges the tables of the two maps, without touching their mutexes.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::swap_table(hash_map& m) noexcept{
+    std::swap(ctrl_storage, m.ctrl_storage);
+    std::swap(ctrl, m.ctrl);
+    std::swap(slots, m.slots);
+    std::swap(capacity, m.capacity);
+    std::swap(size, m.size);
+    std::swap(growth_left, m.growth_left);
+};
+
+/**
+ * @brief Copies the table of m slot by slot. The deleted markers are copied too: dropping them would
+ * end the probe sequences of keys that were placed past an erased slot.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::copy_from(const hash_map& m){
+    allocate_table(m.capacity);
+
+    for(size_t i = 0; i < m.capacity; ++i){
+        if(m.ctrl[i] == ctrl_empty) continue;
+
+        if(m.ctrl[i] >= 0) new (slots + i) value_type(m.slots[i]);
+        set_ctrl(i, m.ctrl[i]);
+    }
+    size = m.size;
+    growth_left = m.growth_left;
+};
+
+/**
+ * @brief Default constructor. Creates an empty map with room for 14 elements.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>::hash_map() : ctrl(nullptr), slots(nullptr), capacity(0), size(0), growth_left(0){
+    allocate_table(min_capacity);
+};
+
+/**
+ * @brief Constructor that sizes the table for expected elements, so that filling it never rehashes.
+ * 
+ * @note the time complexity is O(expected)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>::hash_map(size_t expected) : ctrl(nullptr), slots(nullptr), capacity(0), size(0), growth_left(0){
+    size_t new_capacity = min_capacity;
+    while(new_capacity - new_capacity / 8 < expected) new_capacity *= 2;
+    allocate_table(new_capacity);
+};
+
+/**
+ * @brief Copy constructor. The slots are copied in place, without rehashing.
+ * 
+ * @note the time complexity is O(m.capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>::hash_map(const hash_map& m) : ctrl(nullptr), slots(nullptr), capacity(0), size(0), growth_left(0), hasher(m.hasher), eq(m.eq), alloc(m.alloc){
+    std::lock_guard<std::mutex> lock(m.mtx_);
+    copy_from(m);
+};
+
+/**
+ * @brief Move constructor. The source is left with an empty table of the minimum capacity.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>::hash_map(hash_map&& m) : ctrl(nullptr), slots(nullptr), capacity(0), size(0), growth_left(0), hasher(m.hasher), eq(m.eq), alloc(m.alloc){
+    allocate_table(min_capacity);
+
+    std::lock_guard<std::mutex> lock(m.mtx_);
+    swap_table(m);
+};
+
+/**
+ * @brief Destructor. Destroys the elements and releases the table.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>::~hash_map(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator.
+ * 
+ * @note the time complexity is O(capacity + m.capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>& hash_map<K, V, Hash, KeyEqual, Alloc>::operator=(const hash_map& m){
+    if(this != &m){
+        std::lock(mtx_, m.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(m.mtx_, std::adopt_lock);
+
+        clean_up();
+        hasher = m.hasher;
+        eq = m.eq;
+        copy_from(m);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source gets the previous table of this map, emptied.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+hash_map<K, V, Hash, KeyEqual, Alloc>& hash_map<K, V, Hash, KeyEqual, Alloc>::operator=(hash_map&& m) noexcept{
+    if(this != &m){
+        std::lock(mtx_, m.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(m.mtx_, std::adopt_lock);
+
+        swap_table(m);
+        std::swap(hasher, m.hasher);
+        std::swap(eq, m.eq);
+        std::swap(alloc, m.alloc);
+
+        m.destroy_elements();
+    }
+    return *this;
+};
+
+/**
+ * @brief Inserts the pair if key is not already present.
+ *
+ * @return True if the pair was inserted.
+ * 
+ * @note the time complexity is O(1) amortized
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::insert(const K& key, const V& value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return insert_hashed(key, value, hash_of(key), false);
+};
+
+/**
+ * @brief Inserts the pair, or replaces the value if key is already present.
+ *
+ * @return True if a new pair was inserted.
+ * 
+ * @note the time complexity is O(1) amortized
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::insert_or_assign(const K& key, const V& value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return insert_hashed(key, value, hash_of(key), true);
+};
+
+/**
+ * @brief Accesses the value mapped to key, inserting a default constructed value if the key is not present.
+ * 
+ * @note the time complexity is O(1) amortized
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+V& hash_map<K, V, Hash, KeyEqual, Alloc>::operator[](const K& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t hash = hash_of(key);
+    size_t index = find_index(key, hash);
+    if(index == npos){
+        insert_hashed(key, V(), hash, false);
+        index = find_index(key, hash);
+    }
+    return slots[index].second;
+};
+
+/**
+ * @brief Removes the pair with the given key if present.
+ *
+ * @return True if a pair was removed.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::erase(const K& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return erase_hashed(find_index(key, hash_of(key)));
+};
+
+/**
+ * @brief Grows the table so that expected elements fit without further rehashing.
+ * 
+ * @note the time complexity is O(capacity) if the table grows, O(1) otherwise
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::reserve(size_t expected){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    size_t new_capacity = capacity;
+    while(new_capacity - new_capacity / 8 < expected) new_capacity *= 2;
+    if(new_capacity != capacity) rehash(new_capacity);
+};
+
+/**
+ * @brief Removes every pair and shrinks the table back to its initial capacity.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void hash_map<K, V, Hash, KeyEqual, Alloc>::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    clean_up();
+    allocate_table(min_capacity);
+};
+
+/**
+ * @brief Looks key up without throwing.
+ *
+ * @return An iterator to the pair, or end() if the key is not present.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::iterator hash_map<K, V, Hash, KeyEqual, Alloc>::find(const K& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    return iterator(this, index == npos ? capacity : index);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator hash_map<K, V, Hash, KeyEqual, Alloc>::find(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    return const_iterator(this, index == npos ? capacity : index);
+};
+
+/**
+ * @brief Returns a copy of the value mapped to key, or an empty optional if the key is not present.
+ * Unlike find, the result stays valid whatever other threads do to the map.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+std::optional<V> hash_map<K, V, Hash, KeyEqual, Alloc>::get(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    if(index == npos) return std::nullopt;
+    return slots[index].second;
+};
+
+/**
+ * @brief Accesses the value mapped to key.
+ *
+ * @throws std::out_of_range If the key is not present.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+V& hash_map<K, V, Hash, KeyEqual, Alloc>::at(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    if(index == npos) throw std::out_of_range("Key not found!");
+    return slots[index].second;
+};
+
+/**
+ * @brief Checks whether key is present.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::contains(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return find_index(key, hash_of(key)) != npos;
+};
+
+/**
+ * @brief Heterogeneous lookup: finds the pair whose key compares equal to key, without converting it to K.
+ * 
+ * @note the time complexity is O(1) expected
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::iterator hash_map<K, V, Hash, KeyEqual, Alloc>::find(const Q& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    return iterator(this, index == npos ? capacity : index);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator hash_map<K, V, Hash, KeyEqual, Alloc>::find(const Q& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    return const_iterator(this, index == npos ? capacity : index);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+std::optional<V> hash_map<K, V, Hash, KeyEqual, Alloc>::get(const Q& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t index = find_index(key, hash_of(key));
+    if(index == npos) return std::nullopt;
+    return slots[index].second;
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template<typename Q, typename H, typename E, typename>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::contains(const Q& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return find_index(key, hash_of(key)) != npos;
+};
+
+/**
+ * @brief Returns the number of pairs.
+ * 
+ * @note The time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+size_t hash_map<K, V, Hash, KeyEqual, Alloc>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Checks if the map is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+bool hash_map<K, V, Hash, KeyEqual, Alloc>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Returns the ratio between the number of pairs and the number of slots.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+float hash_map<K, V, Hash, KeyEqual, Alloc>::load_factor() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return capacity == 0 ? 0.0f : static_cast<float>(size) / static_cast<float>(capacity);
+};
+
+/**
+ * @brief Iterator over the pairs of the map, in slot order.
+ *
+ * Like the vector iterators it does not hold the lock: it is invalidated by any insertion that rehashes.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+class hash_map<K, V, Hash, KeyEqual, Alloc>::iterator{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename hash_map<K, V, Hash, KeyEqual, Alloc>::value_type;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        iterator(hash_map* m, size_t i) : owner(m), index(i){
+            skip_free();
+        }
+
+        reference operator*() const{
+            return owner->slots[index];
+        }
+        pointer operator->() const{
+            return owner->slots + index;
+        }
+        iterator& operator++(){
+            ++index;
+            skip_free();
+            return *this;
+        }
+        iterator operator++(int){
+            iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+        bool operator==(const iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const iterator& other) const{
+            return index != other.index;
+        }
+
+    private:
+        hash_map* owner;
+        size_t index;
+
+        void skip_free(){
+            while(index < owner->capacity && owner->ctrl[index] < 0) ++index;
+        }
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+class hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = const typename hash_map<K, V, Hash, KeyEqual, Alloc>::value_type;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        const_iterator(const hash_map* m, size_t i) : owner(m), index(i){
+            skip_free();
+        }
+
+        reference operator*() const{
+            return owner->slots[index];
+        }
+        pointer operator->() const{
+            return owner->slots + index;
+        }
+        const_iterator& operator++(){
+            ++index;
+            skip_free();
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+        bool operator==(const const_iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const{
+            return index != other.index;
+        }
+
+    private:
+        const hash_map* owner;
+        size_t index;
+
+        void skip_free(){
+            while(index < owner->capacity && owner->ctrl[index] < 0) ++index;
+        }
+};
+
+/**
+ * @brief Creates an iterator pointing to the first pair.
+ * 
+ * @note the time complexity is O(capacity) in the worst case
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::iterator hash_map<K, V, Hash, KeyEqual, Alloc>::begin(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return iterator(this, 0);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::iterator hash_map<K, V, Hash, KeyEqual, Alloc>::end(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return iterator(this, capacity);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator hash_map<K, V, Hash, KeyEqual, Alloc>::begin() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return const_iterator(this, 0);
+};
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename hash_map<K, V, Hash, KeyEqual, Alloc>::const_iterator hash_map<K, V, Hash, KeyEqual, Alloc>::end() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return const_iterator(this, capacity);
+};
+
+#endif
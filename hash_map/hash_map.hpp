@@ -0,0 +1,122 @@
+#ifndef HASH_MAP_HPP
+#define HASH_MAP_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "../vector/vector.cpp"
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file hash_map.hpp
+ * @brief Thread-safe open-addressing hash map in the Swiss-table style.
+ *
+ * Every slot has a one byte control code kept in a separate, contiguous vector: empty, deleted, or the low 7 bits
+ * of the key hash. Lookups load 16 control bytes at once and compare them against the 7 bit tag with SSE2 (or a
+ * portable fallback), so only slots whose tag matches are compared against the key, and a probe sequence usually
+ * touches a single cache line of control bytes. The slots are raw storage obtained from Alloc and the table grows
+ * by doubling when it is 7/8 full.
+ *
+ * Lookups with a type other than K (e.g. a string_view for a std::string key) are available when both Hash and
+ * KeyEqual declare is_transparent.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+class concurrent_hash_map;
+
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Alloc = allocator<std::pair<K, V>>>
+class hash_map{
+    public:
+        using value_type = std::pair<K, V>;
+
+        class iterator;
+        class const_iterator;
+
+    private:
+        static constexpr int8_t ctrl_empty = -128;
+        static constexpr int8_t ctrl_deleted = -2;
+        static constexpr size_t group_width = 16;
+        static constexpr size_t min_capacity = 16;
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        struct control_group;
+
+        vector<int8_t> ctrl_storage;
+        int8_t* ctrl;
+        value_type* slots;
+        size_t capacity, size, growth_left;
+        Hash hasher;
+        KeyEqual eq;
+        Alloc alloc;
+        mutable std::mutex mtx_;
+
+        template<typename, typename, typename, typename, typename>
+        friend class concurrent_hash_map;
+
+        template<typename Q>
+        size_t hash_of(const Q& key) const;
+        template<typename Q>
+        size_t find_index(const Q& key, size_t hash) const;
+        size_t find_insert_slot(size_t hash) const;
+        void set_ctrl(size_t index, int8_t code);
+        void allocate_table(size_t new_capacity);
+        void rehash(size_t new_capacity);
+        void clean_up();
+        void destroy_elements();
+        void swap_table(hash_map& m) noexcept;
+        void copy_from(const hash_map& m);
+
+        template<typename KArg, typename VArg>
+        bool insert_hashed(KArg&& key, VArg&& value, size_t hash, bool assign);
+        bool erase_hashed(size_t index);
+
+        template<typename Q, typename H, typename E>
+        using if_transparent = std::void_t<typename H::is_transparent, typename E::is_transparent, Q>;
+
+    public:
+        hash_map();
+        explicit hash_map(size_t expected);
+        hash_map(const hash_map& m);
+        hash_map(hash_map&& m);
+        ~hash_map();
+
+        hash_map& operator=(const hash_map& m);
+        hash_map& operator=(hash_map&& m) noexcept;
+
+        bool insert(const K& key, const V& value);
+        bool insert_or_assign(const K& key, const V& value);
+        V& operator[](const K& key);
+        bool erase(const K& key);
+        void reserve(size_t expected);
+        void clear();
+
+        iterator find(const K& key);
+        const_iterator find(const K& key) const;
+        std::optional<V> get(const K& key) const;
+        V& at(const K& key) const;
+        bool contains(const K& key) const;
+
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = if_transparent<Q, H, E>>
+        iterator find(const Q& key);
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = if_transparent<Q, H, E>>
+        const_iterator find(const Q& key) const;
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = if_transparent<Q, H, E>>
+        std::optional<V> get(const Q& key) const;
+        template<typename Q, typename H = Hash, typename E = KeyEqual, typename = if_transparent<Q, H, E>>
+        bool contains(const Q& key) const;
+
+        size_t get_size() const;
+        bool empty() const;
+        float load_factor() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
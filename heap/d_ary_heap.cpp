@@ -0,0 +1,318 @@
+#ifndef D_ARY_HEAP_CPP
+#define D_ARY_HEAP_CPP
+#include "d_ary_heap.hpp"
+
+/*
+    @file d_ary_heap.cpp
+    @brief The current cpp source file contains the actual implementation of the d_ary_heap class.
+    Definitions are given in this file since it is a template class.
+*/
+
+/**
+ * @brief Constructor that creates an empty heap.
+ *
+ * @param c The comparison object.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+d_ary_heap<T, Arity, Compare, Mutex>::d_ary_heap(const Compare& c) : comp(c){};
+
+/**
+ * @brief Constructor that builds the heap from a range bottom-up, in linear time.
+ *
+ * The element at position i of the range gets handle i.
+ *
+ * @param first Iterator to the first element.
+ * @param last Iterator past the last element.
+ * @param c The comparison object.
+ *
+ * @note the time complexity is O(n)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+template<typename InputIt>
+d_ary_heap<T, Arity, Compare, Mutex>::d_ary_heap(InputIt first, InputIt last, const Compare& c) : comp(c){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+
+    for(size_t i = 0; first != last; ++first, ++i){
+        h.push_back(entry{*first, i});
+        p.push_back(i);
+    }
+
+    const size_t n = h.get_size();
+    if(n < 2) return;
+    for(size_t i = (n - 2) / Arity + 1; i-- > 0;) sift_down(h, p, i);
+};
+
+/**
+ * @brief Inserts a value.
+ *
+ * @param value The value to insert.
+ * @return The handle of the element, valid until the element is popped or erased.
+ *
+ * @note the time complexity is O(log_Arity(n)) amortized
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+typename d_ary_heap<T, Arity, Compare, Mutex>::handle d_ary_heap<T, Arity, Compare, Mutex>::push(const T& value){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+
+    const size_t index = h.get_size();
+    const handle id = acquire(p, index);
+    h.push_back(entry{value, id});
+    sift_up(h, p, index);
+    return id;
+};
+
+/**
+ * @brief Removes the top element and returns it.
+ *
+ * @return The removed element.
+ * @throws std::out_of_range If the heap is empty.
+ *
+ * @note the time complexity is O(Arity * log_Arity(n))
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+T d_ary_heap<T, Arity, Compare, Mutex>::pop(){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+    if(h.empty()) throw std::out_of_range("Out of range!");
+
+    T value = std::move(h[0].value);
+    remove_at(h, p, 0);
+    return value;
+};
+
+/**
+ * @brief Returns a copy of the top element.
+ *
+ * @throws std::out_of_range If the heap is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+T d_ary_heap<T, Arity, Compare, Mutex>::top() const{
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    if(h.empty()) throw std::out_of_range("Out of range!");
+    return h[0].value;
+};
+
+/**
+ * @brief Returns a copy of the element of a handle.
+ *
+ * @throws std::invalid_argument If the handle is not valid.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+T d_ary_heap<T, Arity, Compare, Mutex>::get(handle id) const{
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+    return h[locate(p, id)].value;
+};
+
+/**
+ * @brief Moves an element towards the top by giving it a value of no lower priority.
+ *
+ * Under the default std::less the new value is not smaller than the current one; under std::greater (a min-heap)
+ * it is not larger, which is the classic decrease-key.
+ *
+ * @param id The handle of the element.
+ * @param value The new value, which must not compare lower than the current one.
+ * @throws std::invalid_argument If the handle is not valid or the value has lower priority.
+ *
+ * @note the time complexity is O(log_Arity(n))
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::increase_priority(handle id, const T& value){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+
+    const size_t index = locate(p, id);
+    if(comp(value, h[index].value)) throw std::invalid_argument("increase_priority would lower the priority");
+    h[index].value = value;
+    sift_up(h, p, index);
+};
+
+/**
+ * @brief Changes the value of an element in either direction.
+ *
+ * @param id The handle of the element.
+ * @param value The new value.
+ * @throws std::invalid_argument If the handle is not valid.
+ *
+ * @note the time complexity is O(Arity * log_Arity(n))
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::update(handle id, const T& value){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+
+    const size_t index = locate(p, id);
+    const bool raised = comp(h[index].value, value);
+    h[index].value = value;
+    if(raised) sift_up(h, p, index);
+    else sift_down(h, p, index);
+};
+
+/**
+ * @brief Removes the element of a handle, e.g. a cancelled timer.
+ *
+ * @param id The handle of the element.
+ * @throws std::invalid_argument If the handle is not valid.
+ *
+ * @note the time complexity is O(Arity * log_Arity(n))
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::erase(handle id){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+    remove_at(h, p, locate(p, id));
+};
+
+/**
+ * @brief Removes every element. All handles become invalid.
+ *
+ * @note the time complexity is O(n)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::clear(){
+    std::lock_guard<Mutex> lock(mtx_);
+    heap_batch h(heap, std::defer_lock);
+    position_batch p(positions, std::defer_lock);
+    h.clear();
+    p.clear();
+    free_head = npos;
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+size_t d_ary_heap<T, Arity, Compare, Mutex>::get_size() const{
+    std::lock_guard<Mutex> lock(mtx_);
+    return heap_batch(heap, std::defer_lock).get_size();
+};
+
+/**
+ * @brief Checks if the heap is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+bool d_ary_heap<T, Arity, Compare, Mutex>::empty() const{
+    return get_size() == 0;
+};
+
+/**
+ * @brief Returns a free handle, recycled from the free list threaded through positions, pointing to index.
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+typename d_ary_heap<T, Arity, Compare, Mutex>::handle d_ary_heap<T, Arity, Compare, Mutex>::acquire(position_batch& p, size_t index){
+    if(free_head == npos){
+        p.push_back(index);
+        return p.get_size() - 1;
+    }
+
+    const handle id = free_head;
+    const size_t next = p[id] & ~free_bit;
+    free_head = next == (npos & ~free_bit) ? npos : next;
+    p[id] = index;
+    return id;
+};
+
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::release(position_batch& p, handle id){
+    p[id] = free_bit | (free_head & ~free_bit);
+    free_head = id;
+};
+
+/**
+ * @brief Returns the heap index of a handle.
+ *
+ * @throws std::invalid_argument If the handle is not valid.
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+size_t d_ary_heap<T, Arity, Compare, Mutex>::locate(position_batch& p, handle id) const{
+    if(id >= p.get_size() || (p[id] & free_bit)) throw std::invalid_argument("Invalid heap handle");
+    return p[id];
+};
+
+/**
+ * @brief Moves the element at index up while it has priority over its parent, shifting the parents down into the hole.
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::sift_up(heap_batch& h, position_batch& p, size_t index){
+    entry moving = std::move(h[index]);
+
+    while(index > 0){
+        const size_t parent = (index - 1) / Arity;
+        if(!comp(h[parent].value, moving.value)) break;
+        h[index] = std::move(h[parent]);
+        p[h[index].id] = index;
+        index = parent;
+    }
+
+    h[index] = std::move(moving);
+    p[h[index].id] = index;
+};
+
+/**
+ * @brief Moves the element at index down while a child has priority over it. The Arity children are contiguous.
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::sift_down(heap_batch& h, position_batch& p, size_t index){
+    const size_t n = h.get_size();
+    entry moving = std::move(h[index]);
+
+    while(true){
+        const size_t first = index * Arity + 1;
+        if(first >= n) break;
+
+        const size_t last = first + Arity < n ? first + Arity : n;
+        size_t best = first;
+        for(size_t c = first + 1; c < last; ++c){
+            if(comp(h[best].value, h[c].value)) best = c;
+        }
+        if(!comp(moving.value, h[best].value)) break;
+
+        h[index] = std::move(h[best]);
+        p[h[index].id] = index;
+        index = best;
+    }
+
+    h[index] = std::move(moving);
+    p[h[index].id] = index;
+};
+
+/**
+ * @brief Removes the element at index, filling the hole with the last element and restoring the heap order.
+ */
+template<typename T, size_t Arity, typename Compare, typename Mutex>
+void d_ary_heap<T, Arity, Compare, Mutex>::remove_at(heap_batch& h, position_batch& p, size_t index){
+    release(p, h[index].id);
+
+    const size_t last = h.get_size() - 1;
+    if(index != last){
+        h[index] = std::move(h[last]);
+        p[h[index].id] = index;
+    }
+    h.pop_back();
+    if(index >= last) return;
+
+    if(index > 0 && comp(h[(index - 1) / Arity].value, h[index].value)) sift_up(h, p, index);
+    else sift_down(h, p, index);
+};
+
+#endif
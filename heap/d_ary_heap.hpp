@@ -0,0 +1,96 @@
+#ifndef D_ARY_HEAP_HPP
+#define D_ARY_HEAP_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include "../vector/vector.cpp"
+
+/**
+ * @file d_ary_heap.hpp
+ * @brief d-ary heap priority queue over vector, with handles for increase_priority, update and erase.
+ *
+ * Every node has Arity children stored next to each other, so with 4 or 8 children the candidates compared while
+ * sifting down share one or two cache lines and the heap is log2(Arity) times shallower than a binary one. push
+ * returns a handle that follows the element as it moves, which makes increase_priority, update and erase O(log n)
+ * (e.g. rescheduling or cancelling a timer). Building from a range uses Floyd's O(n) bottom-up construction.
+ *
+ * As Compare defaults to std::less, top() is the largest element, like std::priority_queue; std::greater gives a
+ * min-heap, as needed for timers. Priority follows Compare, so increase_priority moves a value up the order: a
+ * larger value by default, a smaller one (the classic decrease-key) with std::greater.
+ *
+ * The heap takes no lock by default, as it is usually owned by a single scheduler thread. With Mutex =
+ * std::mutex every operation holds that mutex, one lock per operation, and the heap can be shared between
+ * threads. The underlying vectors are always accessed through unlocked batches.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Arity Number of children per node, at least 2.
+ * @tparam Compare Strict weak ordering; the top element is one that no other compares greater than.
+ * @tparam Mutex Locking policy: null_mutex (no locking) or std::mutex.
+ *
+ * @author Andrea Maggetto
+ */
+
+/**
+ * @brief Mutex that does nothing, the default locking policy of d_ary_heap.
+ */
+struct null_mutex{
+    void lock(){}
+    void unlock(){}
+    bool try_lock(){
+        return true;
+    }
+};
+
+template<typename T, size_t Arity = 4, typename Compare = std::less<T>, typename Mutex = null_mutex>
+class d_ary_heap{
+    static_assert(Arity >= 2, "d_ary_heap needs at least 2 children per node");
+
+    public:
+        using handle = size_t;
+
+    private:
+        static constexpr size_t npos = SIZE_MAX;
+        static constexpr size_t free_bit = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+        struct entry{
+            T value;
+            handle id;
+        };
+
+        using heap_batch = typename vector<entry>::batch;
+        using position_batch = typename vector<size_t>::batch;
+
+        mutable vector<entry> heap;
+        mutable vector<size_t> positions;
+        size_t free_head = npos;
+        Compare comp;
+        mutable Mutex mtx_;
+
+        handle acquire(position_batch& p, size_t index);
+        void release(position_batch& p, handle id);
+        size_t locate(position_batch& p, handle id) const;
+        void sift_up(heap_batch& h, position_batch& p, size_t index);
+        void sift_down(heap_batch& h, position_batch& p, size_t index);
+        void remove_at(heap_batch& h, position_batch& p, size_t index);
+
+    public:
+        explicit d_ary_heap(const Compare& c = Compare());
+        template<typename InputIt>
+        d_ary_heap(InputIt first, InputIt last, const Compare& c = Compare());
+
+        handle push(const T& value);
+        T pop();
+        T top() const;
+        T get(handle h) const;
+        void increase_priority(handle h, const T& value);
+        void update(handle h, const T& value);
+        void erase(handle h);
+        void clear();
+
+        size_t get_size() const;
+        bool empty() const;
+};
+
+#endif
@@ -0,0 +1,594 @@
+#include "arena_doubly_linked_list.hpp"
+
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>::arena_doubly_linked_list() = default;
+
+/**
+ * @brief Builds a list of init_size copies of init, laid out sequentially.
+ * @complexity O(init_size)
+ */
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>::arena_doubly_linked_list(const T& init, size_t init_size){
+    grow(init_size);
+    for(size_t i = 0; i < init_size; ++i) push_back_unlocked(init);
+};
+
+/**
+ * @brief Copy constructor. The copy is laid out in list order, without free slots.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>::arena_doubly_linked_list(const arena_doubly_linked_list<T, Alloc>& dll){
+    std::lock_guard<std::mutex> lock(dll.dll_mutex);
+    copy_from(dll);
+};
+
+/**
+ * @brief Move constructor. The arena changes owner as a whole, the source is left empty.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>::arena_doubly_linked_list(arena_doubly_linked_list<T, Alloc>&& dll){
+    std::lock_guard<std::mutex> lock(dll.dll_mutex);
+    nodes = dll.nodes;
+    capacity = dll.capacity;
+    used = dll.used;
+    head = dll.head;
+    tail = dll.tail;
+    free_head = dll.free_head;
+    size = dll.size.load();
+
+    dll.nodes = nullptr;
+    dll.capacity = dll.used = 0;
+    dll.head = dll.tail = dll.free_head = npos;
+    dll.size = 0;
+};
+
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>::~arena_doubly_linked_list(){
+    clean_up();
+};
+
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>& arena_doubly_linked_list<T, Alloc>::operator=(const arena_doubly_linked_list<T, Alloc>& dll){
+    if(this != &dll){
+        std::lock(dll_mutex, dll.dll_mutex);
+        std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+        clean_up();
+        copy_from(dll);
+    }
+    return *this;
+};
+
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>& arena_doubly_linked_list<T, Alloc>::operator=(arena_doubly_linked_list<T, Alloc>&& dll){
+    if(this != &dll){
+        std::lock(dll_mutex, dll.dll_mutex);
+        std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+        clean_up();
+
+        nodes = dll.nodes;
+        capacity = dll.capacity;
+        used = dll.used;
+        head = dll.head;
+        tail = dll.tail;
+        free_head = dll.free_head;
+        size = dll.size.load();
+
+        dll.nodes = nullptr;
+        dll.capacity = dll.used = 0;
+        dll.head = dll.tail = dll.free_head = npos;
+        dll.size = 0;
+    }
+    return *this;
+};
+
+template<typename T, typename Alloc>
+bool arena_doubly_linked_list<T, Alloc>::operator==(const arena_doubly_linked_list<T, Alloc>& dll) const{
+    if(size != dll.size) return false;
+
+    uint32_t it = head;
+    uint32_t it_dll = dll.head;
+
+    while(it != npos){
+        if(nodes[it].info != dll.nodes[it_dll].info) return false;
+        it = nodes[it].next;
+        it_dll = dll.nodes[it_dll].next;
+    }
+
+    return true;
+};
+
+template<typename T, typename Alloc>
+bool arena_doubly_linked_list<T, Alloc>::operator!=(const arena_doubly_linked_list<T, Alloc>& dll) const{
+    return !(*this == dll);
+};
+
+/**
+ * @brief Appends el, reusing a free slot if there is one.
+ * @throw std::length_error If the list already holds 2^32 - 1 elements.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>& arena_doubly_linked_list<T, Alloc>::push_back(const T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    push_back_unlocked(el);
+    return *this;
+};
+
+/**
+ * @brief Prepends el, reusing a free slot if there is one.
+ * @throw std::length_error If the list already holds 2^32 - 1 elements.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Alloc>
+arena_doubly_linked_list<T, Alloc>& arena_doubly_linked_list<T, Alloc>::push_front(const T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    push_front_unlocked(el);
+    return *this;
+};
+
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::push_back_unlocked(const T& el){
+    link_before(npos, acquire(el));
+};
+
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::push_front_unlocked(const T& el){
+    link_before(head, acquire(el));
+};
+
+/**
+ * @brief Appends n elements read from first under a single lock acquisition, growing the arena at most once.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+template<typename InputIt>
+arena_doubly_linked_list<T, Alloc>& arena_doubly_linked_list<T, Alloc>::push_back_n(InputIt first, size_t n){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    grow(used + n);
+    for(size_t i = 0; i < n; ++i, ++first) push_back_unlocked(*first);
+    return *this;
+};
+
+/**
+ * @brief Locks the list once and returns a handle exposing unlocked operations.
+ * Using the list directly from the same thread while the handle is alive deadlocks.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::batch arena_doubly_linked_list<T, Alloc>::lock_batch(){
+    return batch(*this);
+};
+
+template<typename T, typename Alloc>
+class arena_doubly_linked_list<T, Alloc>::batch{
+    private:
+        arena_doubly_linked_list<T, Alloc>* owner;
+        std::unique_lock<std::mutex> lock;
+    public:
+        explicit batch(arena_doubly_linked_list<T, Alloc>& dll) : owner(&dll), lock(dll.dll_mutex){};
+
+        batch& push_back(const T& el){
+            owner->push_back_unlocked(el);
+            return *this;
+        }
+        batch& push_front(const T& el){
+            owner->push_front_unlocked(el);
+            return *this;
+        }
+        iterator insert(iterator pos, const T& el){
+            const uint32_t added = owner->acquire(el);
+            owner->link_before(pos.current, added);
+            return iterator(owner, added);
+        }
+        size_t get_size() const{
+            return owner->size.load();
+        }
+};
+
+template<typename T, typename Alloc>
+size_t arena_doubly_linked_list<T, Alloc>::get_size() const{
+    return size.load();
+};
+
+/**
+ * @brief Returns the number of nodes the arena holds without growing.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+size_t arena_doubly_linked_list<T, Alloc>::get_capacity() const{
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    return capacity;
+};
+
+template<typename T, typename Alloc>
+class arena_doubly_linked_list<T, Alloc>::iterator{
+    private:
+        arena_doubly_linked_list<T, Alloc>* owner;
+        uint32_t current;
+        friend class arena_doubly_linked_list<T, Alloc>;
+    public:
+        iterator(arena_doubly_linked_list<T, Alloc>* dll, uint32_t init) : owner(dll), current(init){};
+
+        T& operator*(){return owner->nodes[current].info;}
+        T* operator->(){return &owner->nodes[current].info;}
+        iterator& operator++(){
+            current = owner->nodes[current].next;
+            return *this;
+        }
+        iterator operator++(int){
+            iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const iterator& it){return current == it.current;}
+        bool operator!=(const iterator& it){return current != it.current;}
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::iterator arena_doubly_linked_list<T, Alloc>::begin(){
+    return iterator(this, head);
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::iterator arena_doubly_linked_list<T, Alloc>::end(){
+    return iterator(this, npos);
+};
+
+template<typename T, typename Alloc>
+class arena_doubly_linked_list<T, Alloc>::const_iterator{
+    private:
+        const arena_doubly_linked_list<T, Alloc>* owner;
+        uint32_t current;
+    public:
+        const_iterator(const arena_doubly_linked_list<T, Alloc>* dll, uint32_t init) : owner(dll), current(init){};
+
+        const T& operator*() const {return owner->nodes[current].info;}
+        const T* operator->() const{return &owner->nodes[current].info;}
+        const_iterator& operator++(){
+            current = owner->nodes[current].next;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        bool operator==(const const_iterator& it) const{
+            return current == it.current;
+        }
+        bool operator!=(const const_iterator& it) const{
+            return current != it.current;
+        }
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::const_iterator arena_doubly_linked_list<T, Alloc>::begin() const{
+    return const_iterator(this, head);
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::const_iterator arena_doubly_linked_list<T, Alloc>::end() const{
+    return const_iterator(this, npos);
+};
+
+template<typename T, typename Alloc>
+class arena_doubly_linked_list<T, Alloc>::reverse_iterator{
+    private:
+        arena_doubly_linked_list<T, Alloc>* owner;
+        uint32_t current;
+    public:
+        reverse_iterator(arena_doubly_linked_list<T, Alloc>* dll, uint32_t init) : owner(dll), current(init){};
+
+        T& operator*(){return owner->nodes[current].info;}
+        T* operator->(){return &owner->nodes[current].info;}
+        reverse_iterator& operator++(){
+            current = owner->nodes[current].prev;
+            return *this;
+        }
+        reverse_iterator operator++(int){
+            reverse_iterator tmp(*this);
+            current = owner->nodes[current].prev;
+            return tmp;
+        }
+        bool operator==(const reverse_iterator& it){return current == it.current;}
+        bool operator!=(const reverse_iterator& it){return current != it.current;}
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::reverse_iterator arena_doubly_linked_list<T, Alloc>::rbegin(){
+    return reverse_iterator(this, tail);
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::reverse_iterator arena_doubly_linked_list<T, Alloc>::rend(){
+    return reverse_iterator(this, npos);
+};
+
+template<typename T, typename Alloc>
+class arena_doubly_linked_list<T, Alloc>::const_reverse_iterator{
+    private:
+        const arena_doubly_linked_list<T, Alloc>* owner;
+        uint32_t current;
+    public:
+        const_reverse_iterator(const arena_doubly_linked_list<T, Alloc>* dll, uint32_t init) : owner(dll), current(init){};
+
+        const T& operator*() const {return owner->nodes[current].info;}
+        const T* operator->() const{return &owner->nodes[current].info;}
+        const_reverse_iterator& operator++(){
+            current = owner->nodes[current].prev;
+            return *this;
+        }
+        const_reverse_iterator operator++(int){
+            const_reverse_iterator tmp(*this);
+            current = owner->nodes[current].prev;
+            return tmp;
+        }
+        bool operator==(const const_reverse_iterator& it){return current == it.current;}
+        bool operator!=(const const_reverse_iterator& it){return current != it.current;}
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::const_reverse_iterator arena_doubly_linked_list<T, Alloc>::crbegin() const{
+    return const_reverse_iterator(this, tail);
+};
+
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::const_reverse_iterator arena_doubly_linked_list<T, Alloc>::crend() const{
+    return const_reverse_iterator(this, npos);
+};
+
+/**
+ * @brief Inserts el before pos, end() appending it.
+ * @return An iterator to the inserted element.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::iterator arena_doubly_linked_list<T, Alloc>::insert(iterator pos, const T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    const uint32_t added = acquire(el);
+    link_before(pos.current, added);
+    return iterator(this, added);
+};
+
+/**
+ * @brief Erases the element at pos, whose slot goes to the free list.
+ * @return An iterator to the element following the erased one.
+ * @throw std::out_of_range If pos is end().
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename arena_doubly_linked_list<T, Alloc>::iterator arena_doubly_linked_list<T, Alloc>::erase(iterator pos){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(pos.current == npos) throw std::out_of_range("Out of range!");
+
+    const uint32_t next = nodes[pos.current].next;
+    unlink(pos.current);
+    release(pos.current);
+    return iterator(this, next);
+};
+
+/**
+ * @brief Grows the arena to hold at least n nodes.
+ * @throw std::length_error If n exceeds 2^32 - 1.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::reserve(size_t n){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    grow(n);
+};
+
+/**
+ * @brief Renumbers the nodes in list order and drops the free slots, so that traversals scan the arena sequentially.
+ * Iterators and references are invalidated.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::compact(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(capacity == 0) return;
+
+    node* fresh = alloc.allocate(capacity);
+    std::uninitialized_default_construct(fresh, fresh + capacity);
+
+    uint32_t i = 0;
+    for(uint32_t it = head; it != npos; it = nodes[it].next, ++i){
+        fresh[i].info = std::move(nodes[it].info);
+        fresh[i].prev = i == 0 ? npos : i - 1;
+        fresh[i].next = i + 1;
+    }
+
+    std::destroy(nodes, nodes + capacity);
+    alloc.deallocate(nodes, capacity);
+
+    nodes = fresh;
+    used = i;
+    free_head = npos;
+    head = i ? 0 : npos;
+    tail = i ? i - 1 : npos;
+    if(i) nodes[i - 1].next = npos;
+};
+
+/**
+ * @brief Erases every element and frees the arena.
+ * @complexity O(capacity)
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::clear(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    clean_up();
+};
+
+/**
+ * @brief Takes a slot from the free list, or the next unused one, and stores el in it. The caller must hold dll_mutex.
+ */
+template<typename T, typename Alloc>
+uint32_t arena_doubly_linked_list<T, Alloc>::acquire(const T& el){
+    uint32_t index;
+    if(free_head != npos){
+        index = free_head;
+        free_head = nodes[index].next;
+    }
+    else{
+        if(used == capacity) grow(size_t(used) + 1);
+        index = used++;
+    }
+
+    nodes[index].info = el;
+    return index;
+};
+
+/**
+ * @brief Resets the slot to a default T, releasing what the element owned, and pushes it on the free list.
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::release(uint32_t index){
+    nodes[index].info = T();
+    nodes[index].next = free_head;
+    free_head = index;
+};
+
+/**
+ * @brief Links the detached node index before pos, npos meaning at the end.
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::link_before(uint32_t pos, uint32_t index){
+    const uint32_t prev = pos == npos ? tail : nodes[pos].prev;
+
+    nodes[index].prev = prev;
+    nodes[index].next = pos;
+    if(prev == npos) head = index;
+    else nodes[prev].next = index;
+    if(pos == npos) tail = index;
+    else nodes[pos].prev = index;
+    ++size;
+};
+
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::unlink(uint32_t index){
+    const uint32_t prev = nodes[index].prev;
+    const uint32_t next = nodes[index].next;
+
+    if(prev == npos) head = next;
+    else nodes[prev].next = next;
+    if(next == npos) tail = prev;
+    else nodes[next].prev = prev;
+    --size;
+};
+
+/**
+ * @brief Moves the arena to storage for at least min_capacity nodes, doubling the capacity when that is larger.
+ * The links are indices, so the nodes are moved as they are.
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::grow(size_t min_capacity){
+    if(min_capacity <= capacity) return;
+    if(min_capacity >= npos) throw std::length_error("Arena list is full!");
+
+    size_t new_capacity = capacity == 0 ? 16 : size_t(capacity) * 2;
+    if(new_capacity < min_capacity) new_capacity = min_capacity;
+    if(new_capacity >= npos) new_capacity = npos - 1;
+
+    node* fresh = alloc.allocate(new_capacity);
+    std::uninitialized_move(nodes, nodes + used, fresh);
+    std::uninitialized_default_construct(fresh + used, fresh + new_capacity);
+
+    if(nodes){
+        std::destroy(nodes, nodes + capacity);
+        alloc.deallocate(nodes, capacity);
+    }
+    nodes = fresh;
+    capacity = static_cast<uint32_t>(new_capacity);
+};
+
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::clean_up(){
+    if(nodes){
+        std::destroy(nodes, nodes + capacity);
+        alloc.deallocate(nodes, capacity);
+    }
+    nodes = nullptr;
+    capacity = used = 0;
+    head = tail = free_head = npos;
+    size = 0;
+};
+
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::copy_from(const arena_doubly_linked_list<T, Alloc>& dll){
+    grow(dll.size.load());
+    for(uint32_t it = dll.head; it != npos; it = dll.nodes[it].next) push_back_unlocked(dll.nodes[it].info);
+};
+
+/**
+ * @brief Writes the list to a binary stream, see list_stream.hpp.
+ * @throw std::runtime_error If the stream fails.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void arena_doubly_linked_list<T, Alloc>::write_to(std::ostream& os) const{
+    static_assert(std::is_trivially_copyable<T>::value, "write_to requires a trivially copyable T");
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    const uint32_t chunk = list_stream_chunk_elements<T>();
+    list_stream_buffer<T> buffer;
+    uint32_t count = 0;
+
+    list_stream_header::write(os, sizeof(T));
+    for(uint32_t it = head; it != npos; it = nodes[it].next){
+        buffer[count++] = nodes[it].info;
+        if(count == chunk){
+            list_stream_write_chunk(os, buffer.get(), count);
+            count = 0;
+        }
+    }
+    if(count) list_stream_write_chunk(os, buffer.get(), count);
+    list_stream_write_chunk(os, buffer.get(), 0);
+};
+
+/**
+ * @brief Appends the elements of a binary stream written by write_to.
+ * The stream is decoded into a temporary list first and appended under a single lock acquisition, so the
+ * list is left untouched if any chunk is invalid.
+ * @return The number of elements appended.
+ * @throw std::runtime_error If the stream is invalid.
+ * @complexity O(n), where n is the number of elements in the stream.
+ */
+template<typename T, typename Alloc>
+size_t arena_doubly_linked_list<T, Alloc>::read_from(std::istream& is){
+    static_assert(std::is_trivially_copyable<T>::value, "read_from requires a trivially copyable T");
+
+    list_stream_header::read(is, sizeof(T));
+
+    list_stream_buffer<T> buffer;
+    arena_doubly_linked_list<T, Alloc> decoded;
+
+    for(uint32_t count; (count = list_stream_read_chunk(is, buffer.get())) != 0;){
+        decoded.grow(size_t(decoded.used) + count);
+        for(uint32_t i = 0; i < count; ++i) decoded.push_back_unlocked(buffer[i]);
+    }
+
+    const size_t total = decoded.size.load();
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    grow(size_t(used) + total);
+    for(uint32_t it = decoded.head; it != npos; it = decoded.nodes[it].next) push_back_unlocked(decoded.nodes[it].info);
+
+    return total;
+};
+
+template<typename T, typename Alloc>
+std::ostream& operator<<(std::ostream& os, const arena_doubly_linked_list<T, Alloc>& l){
+    os << "[";
+    bool first = true;
+    for(const T& el : l){
+        if(!first) os << ", ";
+        os << el;
+        first = false;
+    }
+    return os << "]";
+};
@@ -0,0 +1,114 @@
+#ifndef ARENA_DOUBLY_LINKED_LIST_HPP
+#define ARENA_DOUBLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include "../list_stream.hpp"
+#include "../../allocators/allocator.hpp"
+
+/**
+ * @file arena_doubly_linked_list.hpp
+ * @brief A thread-safe doubly linked list whose nodes live in one contiguous arena, linked by 32 bit indices.
+ *
+ * A node is the element plus two uint32_t links (8 bytes instead of the 16 bytes of a unique_ptr and a raw
+ * pointer), and no node is allocated on its own: the arena grows by doubling like vector and erased nodes are
+ * recycled through a free list. Links are indices, so the arena can be moved as a whole, and iterators stay
+ * valid when it grows (references to the elements do not). compact() renumbers the nodes in list order so
+ * that a traversal becomes a sequential scan of the arena.
+ *
+ * The list holds at most 2^32 - 1 elements. T must be default constructible: free slots hold a default T. The
+ * arena comes from Alloc, rebound to the node type.
+ */
+
+template<typename T, typename Alloc = allocator<T>>
+class arena_doubly_linked_list{
+    private:
+        static constexpr uint32_t npos = UINT32_MAX;
+
+        struct node{
+            T info;
+            uint32_t prev;
+            uint32_t next;
+        };
+
+        using node_allocator = typename Alloc::template rebind<node>::other;
+
+        node* nodes = nullptr;
+        uint32_t capacity = 0;
+        uint32_t used = 0;
+        uint32_t head = npos;
+        uint32_t tail = npos;
+        uint32_t free_head = npos;
+        std::atomic<size_t> size{0};
+        node_allocator alloc;
+        mutable std::mutex dll_mutex;
+
+        uint32_t acquire(const T& el);
+        void release(uint32_t index);
+        void link_before(uint32_t pos, uint32_t index);
+        void unlink(uint32_t index);
+        void grow(size_t min_capacity);
+        void push_back_unlocked(const T& el);
+        void push_front_unlocked(const T& el);
+        void clean_up();
+        void copy_from(const arena_doubly_linked_list<T, Alloc>& dll);
+
+    public:
+        using value_type = T;
+
+        arena_doubly_linked_list();
+        arena_doubly_linked_list(const T& init, size_t init_size);
+        arena_doubly_linked_list(const arena_doubly_linked_list<T, Alloc>& dll);
+        arena_doubly_linked_list(arena_doubly_linked_list<T, Alloc>&& dll);
+        ~arena_doubly_linked_list();
+
+        arena_doubly_linked_list<T, Alloc>& operator=(const arena_doubly_linked_list<T, Alloc>& dll);
+        arena_doubly_linked_list<T, Alloc>& operator=(arena_doubly_linked_list<T, Alloc>&& dll);
+
+        bool operator==(const arena_doubly_linked_list<T, Alloc>& dll) const;
+        bool operator!=(const arena_doubly_linked_list<T, Alloc>& dll) const;
+
+        arena_doubly_linked_list<T, Alloc>& push_back(const T& el);
+        arena_doubly_linked_list<T, Alloc>& push_front(const T& el);
+        template<typename InputIt>
+        arena_doubly_linked_list<T, Alloc>& push_back_n(InputIt first, size_t n);
+        size_t get_size() const;
+        size_t get_capacity() const;
+
+        void reserve(size_t n);
+        void compact();
+        void clear();
+
+        void write_to(std::ostream& os) const;
+        size_t read_from(std::istream& is);
+
+        class iterator;
+        class const_iterator;
+        class reverse_iterator;
+        class const_reverse_iterator;
+        class batch;
+
+        batch lock_batch();
+
+        iterator begin();
+        iterator end();
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        reverse_iterator rbegin();
+        reverse_iterator rend();
+
+        const_reverse_iterator crbegin() const;
+        const_reverse_iterator crend() const;
+
+        iterator insert(iterator pos, const T& el);
+        iterator erase(iterator pos);
+};
+
+#endif
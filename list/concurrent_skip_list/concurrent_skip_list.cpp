@@ -0,0 +1,415 @@
+#include "concurrent_skip_list.hpp"
+#include <thread>
+#include <algorithm>
+
+/**
+ * @brief Registers the calling thread as a reader for its lifetime, so that no node it can reach is freed.
+ */
+template<typename T, typename Compare>
+class concurrent_skip_list<T, Compare>::pin{
+    private:
+        const concurrent_skip_list<T, Compare>* owner;
+        unsigned parity;
+        size_t stripe;
+
+    public:
+        explicit pin(const concurrent_skip_list<T, Compare>* o) : owner(o), stripe(reader_stripe()){
+            parity = owner->epoch.load() & 1;
+            owner->readers[parity][stripe].count.fetch_add(1);
+        }
+        pin(const pin& p) = delete;
+        pin& operator=(const pin& p) = delete;
+        ~pin(){
+            owner->readers[parity][stripe].count.fetch_sub(1);
+        }
+};
+
+/**
+ * @brief Constructor that creates an unlinked node with top_level + 1 forward links.
+ * @complexity O(level)
+ */
+template<typename T, typename Compare>
+concurrent_skip_list<T, Compare>::node::node(const T& value, int level) : info(value), top_level(level), next(new std::atomic<node*>[level + 1]), marked(false), fully_linked(false){
+    for(int l = 0; l <= level; ++l) next[l].store(nullptr, std::memory_order_relaxed);
+};
+
+/**
+ * @brief Draws the height of a new node: level l is reached with probability 2^-l.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+int concurrent_skip_list<T, Compare>::random_level(){
+    static thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    const int level = __builtin_ctzll(~state);
+    return level < max_level ? level : max_level - 1;
+};
+
+/**
+ * @brief Picks the reader counter stripe of the calling thread.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+size_t concurrent_skip_list<T, Compare>::reader_stripe(){
+    static thread_local size_t stripe = std::hash<std::thread::id>()(std::this_thread::get_id()) % stripes;
+    return stripe;
+};
+
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::equivalent(const T& a, const T& b) const{
+    return !less(a, b) && !less(b, a);
+};
+
+/**
+ * @brief Lock-free search filling, for every level, the last node before value and the first node not before it.
+ * The caller must hold a pin.
+ * @return The highest level where a node equivalent to value was found, -1 if none.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+int concurrent_skip_list<T, Compare>::find(const T& value, node** preds, node** succs) const{
+    int found = -1;
+    node* pred = head;
+
+    for(int level = max_level - 1; level >= 0; --level){
+        node* curr = pred->next[level].load(std::memory_order_acquire);
+
+        while(curr && less(curr->info, value)){
+            pred = curr;
+            curr = pred->next[level].load(std::memory_order_acquire);
+        }
+        if(found == -1 && curr && !less(value, curr->info)) found = level;
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return found;
+};
+
+/**
+ * @brief Queues an unlinked node for deletion once no reader can reach it anymore.
+ * @return True if enough nodes are pending for a reclamation pass to be worth it.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::retire(node* victim){
+    std::lock_guard<std::mutex> lock(retired_mutex);
+    retired.push_back({victim, epoch.load()});
+    return retired.size() >= reclaim_threshold;
+};
+
+/**
+ * @brief Advances the epoch if the readers of the previous parity are gone, then frees the nodes retired at least
+ * two epochs ago: both parities have drained since they were unlinked. Never blocks.
+ * @complexity O(r), where r is the number of retired nodes.
+ */
+template<typename T, typename Compare>
+void concurrent_skip_list<T, Compare>::try_reclaim(){
+    std::unique_lock<std::mutex> lock(retired_mutex, std::try_to_lock);
+    if(!lock.owns_lock()) return;
+
+    uint64_t current = epoch.load();
+    const unsigned previous_parity = (current + 1) & 1;
+    bool drained = true;
+
+    for(size_t s = 0; s < stripes && drained; ++s) drained = readers[previous_parity][s].count.load() == 0;
+    if(drained) epoch.compare_exchange_strong(current, current + 1);
+
+    const uint64_t now = epoch.load();
+    auto still_reachable = std::partition(retired.begin(), retired.end(), [now](const retired_node& r){ return r.epoch + 2 > now; });
+    for(auto it = still_reachable; it != retired.end(); ++it) delete it->victim;
+    retired.erase(still_reachable, retired.end());
+};
+
+/**
+ * @brief Default constructor that initializes an empty list.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+concurrent_skip_list<T, Compare>::concurrent_skip_list() : head(new node(T(), max_level - 1)), size(0), epoch(0){};
+
+/**
+ * @brief Destructor that frees every node. No other thread may use the list anymore.
+ * @complexity O(n + r), where r is the number of retired nodes.
+ */
+template<typename T, typename Compare>
+concurrent_skip_list<T, Compare>::~concurrent_skip_list(){
+    for(retired_node& r : retired) delete r.victim;
+
+    node* current = head;
+    while(current){
+        node* following = current->next[0].load();
+        delete current;
+        current = following;
+    }
+};
+
+/**
+ * @brief Inserts value if no equivalent element is present.
+ *
+ * Only the predecessors of the new node are locked, and only after validating that they are still unmarked and
+ * still point to the expected successors; otherwise the search is retried.
+ *
+ * @return True if the value was inserted.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::insert(const T& value){
+    pin guard(this);
+
+    const int top = random_level();
+    node* preds[max_level];
+    node* succs[max_level];
+
+    while(true){
+        const int found = find(value, preds, succs);
+
+        if(found != -1){
+            node* existing = succs[found];
+            if(!existing->marked.load()){
+                while(!existing->fully_linked.load()) std::this_thread::yield();
+                return false;
+            }
+            continue;
+        }
+
+        node* locked[max_level];
+        int locked_count = 0;
+        bool valid = true;
+
+        for(int level = 0; valid && level <= top; ++level){
+            node* pred = preds[level];
+            node* succ = succs[level];
+
+            if(locked_count == 0 || locked[locked_count - 1] != pred){
+                pred->lock.lock();
+                locked[locked_count++] = pred;
+            }
+            valid = !pred->marked.load() && (!succ || !succ->marked.load()) && pred->next[level].load() == succ;
+        }
+
+        if(valid){
+            node* to_add = new node(value, top);
+
+            for(int level = 0; level <= top; ++level) to_add->next[level].store(succs[level], std::memory_order_relaxed);
+            for(int level = 0; level <= top; ++level) preds[level]->next[level].store(to_add, std::memory_order_release);
+
+            to_add->fully_linked.store(true);
+            ++size;
+        }
+
+        for(int i = 0; i < locked_count; ++i) locked[i]->lock.unlock();
+        if(valid) return true;
+    }
+};
+
+/**
+ * @brief Removes the element equivalent to value if present.
+ *
+ * The victim is logically removed by marking it under its own lock, then physically unlinked under the locks of
+ * its predecessors, then retired.
+ *
+ * @return True if an element was removed.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::erase(const T& value){
+    node* victim = nullptr;
+    bool removed = false;
+    {
+        pin guard(this);
+
+        bool is_marked = false;
+        int top = -1;
+        node* preds[max_level];
+        node* succs[max_level];
+
+        while(true){
+            const int found = find(value, preds, succs);
+            if(found != -1) victim = succs[found];
+
+            if(!is_marked && (found == -1 || !victim->fully_linked.load() || victim->top_level != found || victim->marked.load())) break;
+
+            if(!is_marked){
+                top = victim->top_level;
+                victim->lock.lock();
+                if(victim->marked.load()){
+                    victim->lock.unlock();
+                    break;
+                }
+                victim->marked.store(true);
+                is_marked = true;
+            }
+
+            node* locked[max_level];
+            int locked_count = 0;
+            bool valid = true;
+
+            for(int level = 0; valid && level <= top; ++level){
+                node* pred = preds[level];
+
+                if(locked_count == 0 || locked[locked_count - 1] != pred){
+                    pred->lock.lock();
+                    locked[locked_count++] = pred;
+                }
+                valid = !pred->marked.load() && pred->next[level].load() == victim;
+            }
+
+            if(valid){
+                for(int level = top; level >= 0; --level){
+                    preds[level]->next[level].store(victim->next[level].load(), std::memory_order_release);
+                }
+                victim->lock.unlock();
+                --size;
+                removed = true;
+            }
+
+            for(int i = 0; i < locked_count; ++i) locked[i]->lock.unlock();
+            if(valid) break;
+        }
+    }
+
+    if(removed && retire(victim)) try_reclaim();
+    return removed;
+};
+
+/**
+ * @brief Checks whether an element equivalent to value is present, without taking any lock.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::contains(const T& value) const{
+    pin guard(this);
+
+    node* preds[max_level];
+    node* succs[max_level];
+    const int found = find(value, preds, succs);
+
+    return found != -1 && succs[found]->fully_linked.load() && !succs[found]->marked.load();
+};
+
+/**
+ * @brief Returns the current number of elements.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+size_t concurrent_skip_list<T, Compare>::get_size() const{
+    return size.load();
+};
+
+template<typename T, typename Compare>
+bool concurrent_skip_list<T, Compare>::empty() const{
+    return size.load() == 0;
+};
+
+/**
+ * @class iterator
+ * @brief Ordered, read-only iterator over the skip list.
+ *
+ * It walks the bottom level skipping the marked nodes and shares a pin with its copies, so the nodes it can reach
+ * are not freed while it exists.
+ */
+template<typename T, typename Compare>
+class concurrent_skip_list<T, Compare>::iterator{
+    private:
+        std::shared_ptr<pin> guard;
+        node* current;
+
+        friend class concurrent_skip_list<T, Compare>;
+
+        iterator(std::shared_ptr<pin> g, node* n) : guard(std::move(g)), current(n){
+            skip_marked();
+        }
+
+        void skip_marked(){
+            while(current && (current->marked.load() || !current->fully_linked.load())){
+                current = current->next[0].load(std::memory_order_acquire);
+            }
+        }
+
+    public:
+        using value_type = T;
+        using iterator_category = std::forward_iterator_tag;
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() : current(nullptr){};
+
+        reference operator*() const{
+            return current->info;
+        }
+
+        pointer operator->() const{
+            return &current->info;
+        }
+
+        iterator& operator++(){
+            current = current->next[0].load(std::memory_order_acquire);
+            skip_marked();
+            return *this;
+        }
+
+        iterator operator++(int){
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const{
+            return current == other.current;
+        }
+
+        bool operator!=(const iterator& other) const{
+            return current != other.current;
+        }
+};
+
+/**
+ * @brief Returns an iterator to the element equivalent to value, or end() if it is not present.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+typename concurrent_skip_list<T, Compare>::iterator concurrent_skip_list<T, Compare>::find(const T& value) const{
+    iterator it = lower_bound(value);
+    if(it.current && !equivalent(it.current->info, value)) return end();
+    return it;
+};
+
+/**
+ * @brief Returns an iterator to the first element not ordered before value.
+ * @complexity O(log n) expected
+ */
+template<typename T, typename Compare>
+typename concurrent_skip_list<T, Compare>::iterator concurrent_skip_list<T, Compare>::lower_bound(const T& value) const{
+    std::shared_ptr<pin> guard = std::make_shared<pin>(this);
+
+    node* preds[max_level];
+    node* succs[max_level];
+    find(value, preds, succs);
+
+    return iterator(std::move(guard), succs[0]);
+};
+
+/**
+ * @brief Returns an iterator to the smallest element.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+typename concurrent_skip_list<T, Compare>::iterator concurrent_skip_list<T, Compare>::begin() const{
+    std::shared_ptr<pin> guard = std::make_shared<pin>(this);
+    return iterator(std::move(guard), head->next[0].load(std::memory_order_acquire));
+};
+
+/**
+ * @brief Returns an iterator past the largest element.
+ * @complexity O(1)
+ */
+template<typename T, typename Compare>
+typename concurrent_skip_list<T, Compare>::iterator concurrent_skip_list<T, Compare>::end() const{
+    return iterator();
+};
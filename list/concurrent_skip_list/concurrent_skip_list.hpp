@@ -0,0 +1,100 @@
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <vector>
+
+/**
+ * @file concurrent_skip_list.hpp
+ * @brief A thread-safe, ordered skip list with fine-grained optimistic locking.
+ *
+ * The list keeps unique elements sorted by Compare with O(log n) expected search. It follows the lazy skip list
+ * design: find and contains never lock, insert and erase search without locking and then lock only the
+ * predecessors they modify, validating that nothing changed in between. Erased nodes are first marked, then
+ * unlinked, then retired: they are freed only once every operation or iterator that could still reach them has
+ * finished, tracked with two epoch parities of striped reader counters. Reclamation never blocks; it is retried
+ * by later erasures.
+ *
+ * Iterators visit the elements in order and keep the nodes they can reach alive while they exist; they are
+ * weakly consistent, i.e. they may or may not see concurrent insertions and erasures.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Compare Strict weak ordering of the elements.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T, typename Compare = std::less<T>>
+class concurrent_skip_list{
+    private:
+        static constexpr int max_level = 24;
+        static constexpr size_t stripes = 16;
+        static constexpr size_t reclaim_threshold = 64;
+
+        struct node{
+            T info;
+            int top_level;
+            std::unique_ptr<std::atomic<node*>[]> next;
+            std::mutex lock;
+            std::atomic<bool> marked;
+            std::atomic<bool> fully_linked;
+
+            node(const T& value, int level);
+        };
+
+        struct alignas(64) reader_counter{
+            std::atomic<size_t> count{0};
+        };
+
+        struct retired_node{
+            node* victim;
+            uint64_t epoch;
+        };
+
+        class pin;
+
+        node* head;
+        Compare less;
+        std::atomic<size_t> size;
+        mutable std::atomic<uint64_t> epoch;
+        mutable reader_counter readers[2][stripes];
+        std::mutex retired_mutex;
+        std::vector<retired_node> retired;
+
+        static int random_level();
+        static size_t reader_stripe();
+        bool equivalent(const T& a, const T& b) const;
+        int find(const T& value, node** preds, node** succs) const;
+        bool retire(node* victim);
+        void try_reclaim();
+
+    public:
+        using value_type = T;
+
+        concurrent_skip_list();
+        concurrent_skip_list(const concurrent_skip_list& sl) = delete;
+        ~concurrent_skip_list();
+
+        concurrent_skip_list& operator=(const concurrent_skip_list& sl) = delete;
+
+        bool insert(const T& value);
+        bool erase(const T& value);
+        bool contains(const T& value) const;
+        size_t get_size() const;
+        bool empty() const;
+
+        class iterator;
+        using const_iterator = iterator;
+
+        iterator find(const T& value) const;
+        iterator lower_bound(const T& value) const;
+        iterator begin() const;
+        iterator end() const;
+};
+
+#endif
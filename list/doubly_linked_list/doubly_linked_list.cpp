@@ -1,13 +1,12 @@
 #include "doubly_linked_list.hpp"
 
-template<typename T>
-doubly_linked_list<T>::doubly_linked_list() = default;
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>::doubly_linked_list() = default;
 
-template<typename T>
-doubly_linked_list<T>::doubly_linked_list(const T& init, size_t init_size) : size(0){
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>::doubly_linked_list(const T& init, size_t init_size) : size(0){
     for(size; size < init_size; ++size){
-        std::unique_ptr<node> to_add = std::make_unique<node>();
-        to_add->info = init;
+        std::unique_ptr<node> to_add = make_node(init, pool);
         to_add->prev = tail;
         to_add->next = nullptr;
 
@@ -22,62 +21,106 @@ doubly_linked_list<T>::doubly_linked_list(const T& init, size_t init_size) : siz
     }
 };
 
-template<typename T>
-doubly_linked_list<T>::doubly_linked_list(doubly_linked_list<T>&& dll){
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>::doubly_linked_list(doubly_linked_list<T, Alloc>&& dll){
     head = std::move(dll.head);
     tail = dll.tail;
-    size = dll.size;    
+    size = dll.size.load();
+    pool = dll.pool;
+    prefetch_distance = dll.prefetch_distance;
 
     dll.tail = nullptr;
     dll.size = 0;
+    dll.pool = nullptr;
 };
 
-template<typename T>
-doubly_linked_list<T>::doubly_linked_list(const doubly_linked_list<T>& dll){            
-    node* it = dll.head.get();
+/**
+ * @brief Destructor. The nodes are freed one by one, without recursing along the chain.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>::~doubly_linked_list(){
+    destroy_chain(std::move(head));
+    if(pool) pool->release();
+};
+
+/**
+ * @brief Copy constructor. The copy inherits the locality settings of dll, with its own chunks.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>::doubly_linked_list(const doubly_linked_list<T, Alloc>& dll) : size(0){
+    std::lock_guard<std::mutex> lock(dll.dll_mutex);
+    if(dll.pool) pool = node_pool<node, Alloc>::create();
+    prefetch_distance = dll.prefetch_distance;
 
+    node* it = dll.head.get();
     while(it != nullptr){
-        push_back(it->info);
+        push_back_unlocked(it->info);
         it = it->next.get();
     }
 };
 
-template<typename T>
-doubly_linked_list<T>& doubly_linked_list<T>::operator=(const doubly_linked_list<T>& dll){
+/**
+ * @brief Copy assignment operator. The old nodes are freed one by one, without recursing along the chain, and the
+ * list takes the locality settings of dll, like the copy constructor.
+ * @complexity O(n + m), where n is the size of the current list and m is the size of dll.
+ */
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>& doubly_linked_list<T, Alloc>::operator=(const doubly_linked_list<T, Alloc>& dll){
     if(this != &dll){
-        head.reset();
+        std::lock(dll_mutex, dll.dll_mutex);
+        std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+        destroy_chain(std::move(head));
         tail = nullptr;
         size = 0;
 
+        if(dll.pool && !pool) pool = node_pool<node, Alloc>::create();
+        else if(!dll.pool && pool){
+            pool->release();
+            pool = nullptr;
+        }
+        prefetch_distance = dll.prefetch_distance;
+
         node* it = dll.head.get();
         while(it != nullptr){
-            push_back(it->info);
+            push_back_unlocked(it->info);
             it = it->next.get();
         }
     }
     return *this;
 };
 
-template<typename T>
-doubly_linked_list<T>& doubly_linked_list<T>::operator=(doubly_linked_list<T>&& dll){
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>& doubly_linked_list<T, Alloc>::operator=(doubly_linked_list<T, Alloc>&& dll){
     if(this != &dll){
-        head.reset();
+        std::lock(dll_mutex, dll.dll_mutex);
+        std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+        destroy_chain(std::move(head));
         tail = nullptr;
         size = 0;
+        if(pool) pool->release();
 
         head = std::move(dll.head);
         tail = dll.tail;
-        size = dll.size;
+        size = dll.size.load();
+        pool = dll.pool;
+        prefetch_distance = dll.prefetch_distance;
 
         dll.head = nullptr;
         dll.tail = nullptr;
         dll.size = 0;
+        dll.pool = nullptr;
     }
     return *this;
 };
 
-template<typename T>
-bool doubly_linked_list<T>::operator==(const doubly_linked_list<T>& dll) const{
+template<typename T, typename Alloc>
+bool doubly_linked_list<T, Alloc>::operator==(const doubly_linked_list<T, Alloc>& dll) const{
     if(size != dll.size) return false;
 
     node* it = head.get();
@@ -92,17 +135,30 @@ bool doubly_linked_list<T>::operator==(const doubly_linked_list<T>& dll) const{
     return true;
 };  
 
-template<typename T>
-bool doubly_linked_list<T>::operator!=(const doubly_linked_list<T>& dll) const{
+template<typename T, typename Alloc>
+bool doubly_linked_list<T, Alloc>::operator!=(const doubly_linked_list<T, Alloc>& dll) const{
     return !(*this == dll);
 };
 
-template<typename T>
-doubly_linked_list<T>& push_back(const T& el){       
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>& doubly_linked_list<T, Alloc>::push_back(const T& el){       
     std::lock_guard<std::mutex> lock(dll_mutex);
+    push_back_unlocked(el);
 
-    std::unique_ptr<node> to_add = std::make_unique<node>();
-    to_add->info = el;
+    return *this;
+};
+
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc>& doubly_linked_list<T, Alloc>::push_front(const T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    push_front_unlocked(el);
+
+    return *this;
+};
+
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::push_back_unlocked(const T& el){
+    std::unique_ptr<node> to_add = make_node(el, pool);
     to_add->prev = tail;
     to_add->next = nullptr;
 
@@ -115,17 +171,11 @@ doubly_linked_list<T>& push_back(const T& el){
         tail = tail->next.get();
     }
     ++size;
-
-    return *this;
 };
 
-template<typename T>
-doubly_linked_list<T>& doubly_linked_list<T>::push_front(const T& el){
-    std::lock_guard<std::mutex> lock(dll_mutex);
-
-    std::unique_ptr<node> to_add = std::make_unique<node>();
-
-    to_add->info = el;
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::push_front_unlocked(const T& el){
+    std::unique_ptr<node> to_add = make_node(el, pool);
     to_add->prev = nullptr;
 
     if(!head){
@@ -133,67 +183,150 @@ doubly_linked_list<T>& doubly_linked_list<T>::push_front(const T& el){
         tail = head.get();
     }
     else{
+        head->prev = to_add.get();
         to_add->next = std::move(head);
         head = std::move(to_add);
-        to_add->next->prev = head.get();
     }
+    ++size;
+};
+
+/**
+ * @brief Appends n values read from first. The nodes are chained before locking, then linked with a single O(1) relink.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+template<typename InputIt>
+doubly_linked_list<T, Alloc>& doubly_linked_list<T, Alloc>::push_back_n(InputIt first, size_t n){
+    if(n == 0) return *this;
+
+    node_pool<node, Alloc>* from = retain_pool();
+    std::unique_ptr<node> chain = make_node(*first, from);
+    chain->prev = nullptr;
+
+    node* back = chain.get();
+    for(size_t i = 1; i < n; ++i){
+        ++first;
+        back->next = make_node(*first, from);
+        back->next->prev = back;
+        back = back->next.get();
+    }
+    if(from) from->release();
+
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    link_range_before(nullptr, std::move(chain), back);
+    size += n;
 
     return *this;
 };
 
-template<typename T>
-size_t doubly_linked_list<T>::get_size() const{
+/**
+ * @brief Locks the list once and returns a handle exposing unlocked operations until it is destroyed.
+ * Using the list directly from the same thread while the handle is alive deadlocks.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::batch doubly_linked_list<T, Alloc>::lock_batch(){
+    return batch(*this);
+};
+
+template<typename T, typename Alloc>
+class doubly_linked_list<T, Alloc>::batch{
+    private:
+        doubly_linked_list<T, Alloc>* owner;
+        std::unique_lock<std::mutex> lock;
+    public:
+        explicit batch(doubly_linked_list<T, Alloc>& dll) : owner(&dll), lock(dll.dll_mutex){};
+
+        batch& push_back(const T& el){
+            owner->push_back_unlocked(el);
+            return *this;
+        }
+        batch& push_front(const T& el){
+            owner->push_front_unlocked(el);
+            return *this;
+        }
+        iterator insert(iterator pos, const T& el){
+            std::unique_ptr<node> to_add = owner->make_node(el, owner->pool);
+
+            node* added = to_add.get();
+            owner->link_range_before(pos.current, std::move(to_add), added);
+            ++owner->size;
+
+            return iterator(added);
+        }
+        size_t get_size() const{
+            return owner->size.load();
+        }
+};
+
+template<typename T, typename Alloc>
+size_t doubly_linked_list<T, Alloc>::get_size() const{
     return size.load();
 };
 
-template<typename T>
-class doubly_linked_list<T>::iterator{  
+template<typename T, typename Alloc>
+class doubly_linked_list<T, Alloc>::iterator{  
     private:
         node* current;
+        size_t distance;
+        friend class doubly_linked_list<T, Alloc>;
     public:
-        explicit iterator(node* init) : current(init){};
+        explicit iterator(node* init, size_t distance = 0) : current(init), distance(distance){};
 
         T& operator*(){return current->info;}
         T* operator->(){return &current->info;}
         iterator& operator++(){
             current = current->next.get();
+            if(distance && current){
+                //walked from current on every step: a node farther ahead may have been erased since
+                const node* target = current;
+                for(size_t i = 0; i < distance && target; ++i) target = target->next.get();
+                if(target) prefetch_node(target);
+            }
             return *this;
         }
-        iterator& operator++(int){
+        iterator operator++(int){
             iterator tmp(*this);
-            current = current->next.get();
+            ++(*this);
             return tmp;
         }
         bool operator==(const iterator& it){return current == it.current;}
         bool operator!=(const iterator& it){return current != it.current;}
 };
 
-template<typename T>
-typename doubly_linked_list<T>::iterator doubly_linked_list<T>::begin(){    
-    return iterator(head.get());
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::iterator doubly_linked_list<T, Alloc>::begin(){    
+    return iterator(head.get(), prefetch_distance);
 };
 
-template<typename T>
-typename doubly_linked_list<T>::iterator doubly_linked_list<T>::end(){
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::iterator doubly_linked_list<T, Alloc>::end(){
     return iterator(nullptr);
 };
 
-template<typename T>
-class doubly_linked_list<T>::const_iterator{
+template<typename T, typename Alloc>
+class doubly_linked_list<T, Alloc>::const_iterator{
     private:
         const node* current;
+        size_t distance;
     public:
-        explicit const_iterator(const node* init) : current(init){};
+        explicit const_iterator(const node* init, size_t distance = 0) : current(init), distance(distance){};
 
         const T& operator*() const {return current->info;}
         const T* operator->() const{return &current->info;}
         const_iterator& operator++(){
             current = current->next.get();
+            if(distance && current){
+                //walked from current on every step: a node farther ahead may have been erased since
+                const node* target = current;
+                for(size_t i = 0; i < distance && target; ++i) target = target->next.get();
+                if(target) prefetch_node(target);
+            }
             return *this;
         }
         const_iterator operator++(int){
             const_iterator tmp(*this);
-            current = current->next.get();
+            ++(*this);
             return tmp;
         }
         bool operator==(const const_iterator& it) const{
@@ -204,18 +337,18 @@ class doubly_linked_list<T>::const_iterator{
         }
 };
 
-template<typename T>
-typename doubly_linked_list<T>::const_iterator doubly_linked_list<T>::begin() const{
-    return const_iterator(head.get());
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::const_iterator doubly_linked_list<T, Alloc>::begin() const{
+    return const_iterator(head.get(), prefetch_distance);
 };
 
-template<typename T>
-typename doubly_linked_list<T>::const_iterator doubly_linked_list<T>::end() const{
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::const_iterator doubly_linked_list<T, Alloc>::end() const{
     return const_iterator(nullptr);
 };
 
-template<typename T>
-class doubly_linked_list<T>::reverse_iterator{
+template<typename T, typename Alloc>
+class doubly_linked_list<T, Alloc>::reverse_iterator{
     private:
         node* current;
     public:
@@ -236,18 +369,18 @@ class doubly_linked_list<T>::reverse_iterator{
         bool operator!=(const reverse_iterator& it){return current != it.current;}
 };
 
-template<typename T>
-typename doubly_linked_list<T>::reverse_iterator doubly_linked_list<T>::rbegin(){
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::reverse_iterator doubly_linked_list<T, Alloc>::rbegin(){
     return reverse_iterator(tail);
 };
 
-template<typename T>
-typename doubly_linked_list<T>::reverse_iterator doubly_linked_list<T>::rend(){
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::reverse_iterator doubly_linked_list<T, Alloc>::rend(){
     return reverse_iterator(nullptr);
 };
 
-template<typename T>
-class doubly_linked_list<T>::const_reverse_iterator{
+template<typename T, typename Alloc>
+class doubly_linked_list<T, Alloc>::const_reverse_iterator{
     private:
         const node* current;
     public:
@@ -268,22 +401,471 @@ class doubly_linked_list<T>::const_reverse_iterator{
         bool operator!=(const const_reverse_iterator& it){return current != it.current;}
 };
 
-template<typename T>
-typename doubly_linked_list<T>::const_reverse_iterator doubly_linked_list<T>::crbegin() const{
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::const_reverse_iterator doubly_linked_list<T, Alloc>::crbegin() const{
     return const_reverse_iterator(tail);
 };
 
-template<typename T>
-typename doubly_linked_list<T>::const_reverse_iterator doubly_linked_list<T>::crend() const{
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::const_reverse_iterator doubly_linked_list<T, Alloc>::crend() const{
     return const_reverse_iterator(nullptr);
 };
 
-template<typename T>
-std::ostream& operator<<(std::ostream& os, const doubly_linked_list<T>& l){ 
+/**
+ * @brief Enables or disables locality mode for the nodes allocated from now on.
+ * When enabled, new nodes are carved in address order out of chunks owned by the list. Existing nodes stay
+ * where they are until compact().
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::set_locality(bool enabled){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    if(enabled && !pool) pool = node_pool<node, Alloc>::create();
+    else if(!enabled && pool){
+        pool->release();
+        pool = nullptr;
+    }
+};
+
+/**
+ * @brief Sets how many nodes ahead the forward iterators created from now on prefetch, 0 disabling it.
+ *
+ * Each increment walks that many nodes from the iterator's new position, so a node erased ahead of a live
+ * iterator is never read.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::set_prefetch_distance(size_t distance){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    prefetch_distance = distance;
+};
+
+/**
+ * @brief Moves the elements into fresh nodes laid out sequentially in list order, and enables locality mode.
+ * The old nodes are freed, so iterators and references are invalidated.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::compact(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    node_pool<node, Alloc>* fresh = node_pool<node, Alloc>::create();
+    std::unique_ptr<node> chain;
+    node* back = nullptr;
+
+    try{
+        for(node* it = head.get(); it != nullptr; it = it->next.get()){
+            std::unique_ptr<node> moved(make_pooled_node(fresh));
+            moved->info = std::move_if_noexcept(it->info);
+            moved->prev = back;
+
+            node* added = moved.get();
+            if(back) back->next = std::move(moved);
+            else chain = std::move(moved);
+            back = added;
+        }
+    }
+    catch(...){
+        destroy_chain(std::move(chain));
+        fresh->release();
+        throw;
+    }
+
+    destroy_chain(std::move(head));
+    if(pool) pool->release();
+
+    head = std::move(chain);
+    tail = back;
+    pool = fresh;
+};
+
+/**
+ * @brief Builds a detached node holding a copy of el, in the given pool or on the heap if from is null.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Alloc>
+std::unique_ptr<typename doubly_linked_list<T, Alloc>::node> doubly_linked_list<T, Alloc>::make_node(const T& el, node_pool<node, Alloc>* from){
+    std::unique_ptr<node> to_add(make_pooled_node(from));
+    to_add->info = el;
+    return to_add;
+};
+
+/**
+ * @brief Returns the pool of the list with an extra reference, so that nodes can be built without holding
+ * dll_mutex. The caller must release it.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+node_pool<typename doubly_linked_list<T, Alloc>::node, Alloc>* doubly_linked_list<T, Alloc>::retain_pool(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(pool) pool->retain();
+    return pool;
+};
+
+/**
+ * @brief Frees a chain one node at a time, since destroying the head would recurse once per node.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::destroy_chain(std::unique_ptr<node> chain){
+    while(chain) chain = std::move(chain->next);
+};
+
+/**
+ * @brief Detaches the nodes in [first, last) and returns ownership of the detached chain.
+ * The caller must hold dll_mutex and adjust size.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+std::unique_ptr<typename doubly_linked_list<T, Alloc>::node> doubly_linked_list<T, Alloc>::unlink_range(node* first, node* last){
+    node* back = last ? last->prev : tail;
+    std::unique_ptr<node>& owner = first->prev ? first->prev->next : head;
+
+    std::unique_ptr<node> chain = std::move(owner);
+    owner = std::move(back->next);
+
+    if(last) last->prev = first->prev;
+    else tail = first->prev;
+    first->prev = nullptr;
+
+    return chain;
+};
+
+/**
+ * @brief Links a detached chain ending in back right before pos (nullptr means at the end).
+ * The caller must hold dll_mutex and adjust size.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::link_range_before(node* pos, std::unique_ptr<node> chain, node* back){
+    node* before = pos ? pos->prev : tail;
+    std::unique_ptr<node>& owner = before ? before->next : head;
+
+    chain->prev = before;
+    back->next = std::move(owner);
+
+    if(pos) pos->prev = back;
+    else tail = back;
+
+    owner = std::move(chain);
+};
+
+/**
+ * @brief Releases every node from unique_ptr ownership, returning a raw chain.
+ * While released, prev is reused as the forward link so that sorting relinks nodes without allocating.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::node* doubly_linked_list<T, Alloc>::release_chain(){
+    node* first = head.release();
+
+    for(node* it = first; it != nullptr; it = it->prev) it->prev = it->next.release();
+    tail = nullptr;
+
+    return first;
+};
+
+/**
+ * @brief Takes back ownership of a raw chain produced by release_chain and restores the prev links.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::rebuild_chain(node* first){
+    node* before = nullptr;
+
+    head.reset(first);
+    for(node* it = first; it != nullptr; before = it, it = it->next.get()){
+        it->next.reset(it->prev);
+        it->prev = before;
+    }
+    tail = before;
+};
+
+template<typename T, typename Alloc>
+template<typename Compare>
+typename doubly_linked_list<T, Alloc>::node* doubly_linked_list<T, Alloc>::merge_chains(node* a, node* b, Compare& comp){
+    node* result = nullptr;
+    node** out = &result;
+
+    while(a && b){
+        //take from b only when strictly smaller, which keeps the merge stable
+        if(comp(b->info, a->info)){
+            *out = b;
+            b = b->prev;
+        }
+        else{
+            *out = a;
+            a = a->prev;
+        }
+        out = &(*out)->prev;
+    }
+    *out = a ? a : b;
+
+    return result;
+};
+
+template<typename T, typename Alloc>
+template<typename Compare>
+typename doubly_linked_list<T, Alloc>::node* doubly_linked_list<T, Alloc>::sort_chain(node*& chain, size_t n, Compare& comp){
+    if(n == 1){
+        node* single = chain;
+        chain = chain->prev;
+        single->prev = nullptr;
+        return single;
+    }
+
+    node* left = sort_chain(chain, n / 2, comp);
+    node* right = sort_chain(chain, n - n / 2, comp);
+
+    return merge_chains(left, right, comp);
+};
+
+/**
+ * @brief Inserts a copy of el right before pos.
+ * @return An iterator to the inserted element.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::iterator doubly_linked_list<T, Alloc>::insert(iterator pos, const T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    std::unique_ptr<node> to_add = make_node(el, pool);
+
+    node* added = to_add.get();
+    link_range_before(pos.current, std::move(to_add), added);
+    ++size;
+
+    return iterator(added);
+};
+
+/**
+ * @brief Removes the element pointed by pos.
+ * @return An iterator to the element following the removed one.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename doubly_linked_list<T, Alloc>::iterator doubly_linked_list<T, Alloc>::erase(iterator pos){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    node* following = pos.current->next.get();
+    unlink_range(pos.current, following);
+    --size;
+
+    return iterator(following);
+};
+
+/**
+ * @brief Moves every node of dll right before pos, leaving dll empty. No element is copied.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::splice(iterator pos, doubly_linked_list<T, Alloc>& dll){
+    if(this == &dll) return;
+
+    std::lock(dll_mutex, dll.dll_mutex);
+    std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+    if(!dll.head) return;
+
+    node* back = dll.tail;
+    link_range_before(pos.current, dll.unlink_range(dll.head.get(), nullptr), back);
+
+    size += dll.size.load();
+    dll.size = 0;
+};
+
+/**
+ * @brief Moves the node pointed by it from dll to right before pos. dll may be this list.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::splice(iterator pos, doubly_linked_list<T, Alloc>& dll, iterator it){
+    node* following = it.current->next.get();
+    if(this == &dll && (pos.current == it.current || pos.current == following)) return;
+
+    splice(pos, dll, it, iterator(following));
+};
+
+/**
+ * @brief Moves the nodes in [first, last) from dll to right before pos. dll may be this list,
+ * in which case pos must not be inside [first, last).
+ * @complexity O(1) within the same list, O(distance(first, last)) across lists to update the sizes.
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::splice(iterator pos, doubly_linked_list<T, Alloc>& dll, iterator first, iterator last){
+    if(first == last) return;
+
+    if(this == &dll){
+        std::lock_guard<std::mutex> lock(dll_mutex);
+        if(pos == first || pos == last) return;
+
+        node* back = last.current ? last.current->prev : tail;
+        link_range_before(pos.current, unlink_range(first.current, last.current), back);
+        return;
+    }
+
+    std::lock(dll_mutex, dll.dll_mutex);
+    std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+    size_t moved = 0;
+    for(node* it = first.current; it != last.current; it = it->next.get()) ++moved;
+
+    node* back = last.current ? last.current->prev : dll.tail;
+    link_range_before(pos.current, dll.unlink_range(first.current, last.current), back);
+
+    size += moved;
+    dll.size -= moved;
+};
+
+/**
+ * @brief Splits the list at pos: [pos, end) is moved into the returned list, [begin, pos) stays here.
+ * @complexity O(distance(pos, end)) to update the sizes, no node is copied.
+ */
+template<typename T, typename Alloc>
+doubly_linked_list<T, Alloc> doubly_linked_list<T, Alloc>::split_at(iterator pos){
+    doubly_linked_list<T, Alloc> second;
+    second.size = 0;
+    if(pos.current == nullptr) return second;
+
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    size_t moved = 0;
+    for(node* it = pos.current; it != nullptr; it = it->next.get()) ++moved;
+
+    node* back = tail;
+    second.link_range_before(nullptr, unlink_range(pos.current, nullptr), back);
+
+    second.size = moved;
+    size -= moved;
+
+    return second;
+};
+
+/**
+ * @brief Merges the sorted list dll into this sorted list by relinking nodes, leaving dll empty.
+ * The merge is stable: on ties the elements of this list come first.
+ * @complexity O(n + m)
+ */
+template<typename T, typename Alloc>
+template<typename Compare>
+void doubly_linked_list<T, Alloc>::merge(doubly_linked_list<T, Alloc>& dll, Compare comp){
+    if(this == &dll) return;
+
+    std::lock(dll_mutex, dll.dll_mutex);
+    std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+    rebuild_chain(merge_chains(release_chain(), dll.release_chain(), comp));
+
+    size += dll.size.load();
+    dll.size = 0;
+};
+
+/**
+ * @brief Sorts the list with a stable top-down merge sort that relinks nodes instead of copying values.
+ * Iterators stay valid and keep pointing to the same elements.
+ * @complexity O(n log n) time, O(log n) stack
+ */
+template<typename T, typename Alloc>
+template<typename Compare>
+void doubly_linked_list<T, Alloc>::merge_sort(Compare comp){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    size_t n = size.load();
+    if(n < 2) return;
+
+    node* chain = release_chain();
+    rebuild_chain(sort_chain(chain, n, comp));
+};
+
+/**
+ * @brief Writes the list to a binary stream in the list_stream format, one buffered chunk at a time.
+ * The list is locked for the whole write.
+ * @throw std::runtime_error If the stream fails.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+void doubly_linked_list<T, Alloc>::write_to(std::ostream& os) const{
+    static_assert(std::is_trivially_copyable<T>::value, "write_to requires a trivially copyable T");
+    std::lock_guard<std::mutex> lock(dll_mutex);
+
+    const uint32_t chunk = list_stream_chunk_elements<T>();
+    list_stream_buffer<T> buffer;
+    uint32_t count = 0;
+
+    list_stream_header::write(os, sizeof(T));
+    for(const node* it = head.get(); it != nullptr; it = it->next.get()){
+        buffer[count++] = it->info;
+        if(count == chunk){
+            list_stream_write_chunk(os, buffer.get(), count);
+            count = 0;
+        }
+    }
+    if(count) list_stream_write_chunk(os, buffer.get(), count);
+    list_stream_write_chunk(os, buffer.get(), 0);
+};
+
+/**
+ * @brief Appends the elements of a binary stream written by write_to.
+ * The whole stream is decoded into a detached chain outside the lock and linked at the end in O(1), so
+ * the list is left untouched if any chunk is invalid.
+ * @return The number of elements appended.
+ * @throw std::runtime_error If the stream is invalid.
+ * @complexity O(n), where n is the number of elements in the stream.
+ */
+template<typename T, typename Alloc>
+size_t doubly_linked_list<T, Alloc>::read_from(std::istream& is){
+    static_assert(std::is_trivially_copyable<T>::value, "read_from requires a trivially copyable T");
+
+    list_stream_header::read(is, sizeof(T));
+
+    list_stream_buffer<T> buffer;
+    std::unique_ptr<node> chain;
+    node* back = nullptr;
+    size_t total = 0;
+
+    node_pool<node, Alloc>* from = retain_pool();
+    try{
+        for(uint32_t count; (count = list_stream_read_chunk(is, buffer.get())) != 0; total += count){
+            for(uint32_t i = 0; i < count; ++i){
+                std::unique_ptr<node> to_add = make_node(buffer[i], from);
+                to_add->prev = back;
+                if(back){
+                    back->next = std::move(to_add);
+                    back = back->next.get();
+                }
+                else{
+                    chain = std::move(to_add);
+                    back = chain.get();
+                }
+            }
+        }
+    }
+    catch(...){
+        destroy_chain(std::move(chain));
+        if(from) from->release();
+        throw;
+    }
+    if(from) from->release();
+
+    if(chain){
+        std::lock_guard<std::mutex> lock(dll_mutex);
+        link_range_before(nullptr, std::move(chain), back);
+        size += total;
+    }
+
+    return total;
+};
+
+template<typename T, typename Alloc>
+std::ostream& operator<<(std::ostream& os, const doubly_linked_list<T, Alloc>& l){ 
     os << "[";
-    for(auto it = l.begin(); it != l.end(); ++it) {
+    for(auto it = l.begin(); it != l.end();) {
         os << *it;
-        if (std::next(it) != l.end()) {  // Se non è l'ultimo elemento
+        if (++it != l.end()) {  // Se non è l'ultimo elemento
             os << ", ";
         }
     }
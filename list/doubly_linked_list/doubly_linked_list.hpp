@@ -5,43 +5,96 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <functional>
+#include <type_traits>
+#include <new>
+#include "../list_stream.hpp"
+#include "../node_pool.hpp"
 
-template<typename T>
+/**
+ * @file doubly_linked_list.hpp
+ * @brief A thread-safe doubly linked list with O(1) splicing.
+ *
+ * In locality mode (set_locality) the nodes are carved in address order out of chunks owned by the list, the
+ * forward iterators prefetch the node prefetch_distance steps ahead, and compact() moves the elements into fresh,
+ * sequential nodes after heavy churn. Nodes spliced between lists keep track of the chunks they come from.
+ *
+ * The nodes and the locality chunks come from Alloc, which must be stateless: a spliced node is freed by a list
+ * other than the one that allocated it.
+ */
+
+template<typename T, typename Alloc = allocator<T>>
 class doubly_linked_list{
     private:
         struct node{
             T info;
             node* prev;
             std::unique_ptr<node> next;
+            node_pool<node, Alloc>* pool = nullptr;
+
+            static void operator delete(node* n, std::destroying_delete_t){
+                destroy_pooled_node(n);
+            }
         };
 
         std::unique_ptr<node> head;
         node* tail = nullptr;
         mutable std::mutex dll_mutex;
         std::atomic<size_t> size;
+        node_pool<node, Alloc>* pool = nullptr;
+        size_t prefetch_distance = 0;
+
+        std::unique_ptr<node> make_node(const T& el, node_pool<node, Alloc>* from);
+        node_pool<node, Alloc>* retain_pool();
+        static void destroy_chain(std::unique_ptr<node> chain);
+
+        std::unique_ptr<node> unlink_range(node* first, node* last);
+        void link_range_before(node* pos, std::unique_ptr<node> chain, node* back);
+        node* release_chain();
+        void rebuild_chain(node* first);
+        void push_back_unlocked(const T& el);
+        void push_front_unlocked(const T& el);
+
+        template<typename Compare>
+        static node* merge_chains(node* a, node* b, Compare& comp);
+        template<typename Compare>
+        static node* sort_chain(node*& chain, size_t n, Compare& comp);
 
     public:
         using value_type = T;
 
         doubly_linked_list();
         doubly_linked_list(const T& init, size_t init_size);
-        doubly_linked_list(const doubly_linked_list<T>& dll);
-        doubly_linked_list(doubly_linked_list<T>&& dll);
+        doubly_linked_list(const doubly_linked_list<T, Alloc>& dll);
+        doubly_linked_list(doubly_linked_list<T, Alloc>&& dll);
+        ~doubly_linked_list();
 
-        doubly_linked_list<T>& operator=(const doubly_linked_list<T>& dll);
-        doubly_linked_list<T>& operator=(doubly_linked_list<T>&& dll);
+        doubly_linked_list<T, Alloc>& operator=(const doubly_linked_list<T, Alloc>& dll);
+        doubly_linked_list<T, Alloc>& operator=(doubly_linked_list<T, Alloc>&& dll);
 
-        bool operator==(const doubly_linked_list<T>& dll) const;
-        bool operator!=(const doubly_linked_list<T>& dll) const;
+        bool operator==(const doubly_linked_list<T, Alloc>& dll) const;
+        bool operator!=(const doubly_linked_list<T, Alloc>& dll) const;
 
-        doubly_linked_list<T>& push_back(const T& el);
-        doubly_linked_list<T>& push_front(const T& el);
+        doubly_linked_list<T, Alloc>& push_back(const T& el);
+        doubly_linked_list<T, Alloc>& push_front(const T& el);
+        template<typename InputIt>
+        doubly_linked_list<T, Alloc>& push_back_n(InputIt first, size_t n);
         size_t get_size() const;
 
+        void set_locality(bool enabled);
+        void set_prefetch_distance(size_t distance);
+        void compact();
+
+        void write_to(std::ostream& os) const;
+        size_t read_from(std::istream& is);
+
         class iterator;
         class const_iterator;
         class reverse_iterator;
         class const_reverse_iterator;
+        class batch;
+
+        batch lock_batch();
 
         iterator begin();
         iterator end();
@@ -54,6 +107,19 @@ class doubly_linked_list{
 
         const_reverse_iterator crbegin() const;
         const_reverse_iterator crend() const;
+
+        iterator insert(iterator pos, const T& el);
+        iterator erase(iterator pos);
+
+        void splice(iterator pos, doubly_linked_list<T, Alloc>& dll);
+        void splice(iterator pos, doubly_linked_list<T, Alloc>& dll, iterator it);
+        void splice(iterator pos, doubly_linked_list<T, Alloc>& dll, iterator first, iterator last);
+        doubly_linked_list<T, Alloc> split_at(iterator pos);
+
+        template<typename Compare = std::less<T>>
+        void merge(doubly_linked_list<T, Alloc>& dll, Compare comp = Compare());
+        template<typename Compare = std::less<T>>
+        void merge_sort(Compare comp = Compare());
 };
 
 
@@ -0,0 +1,350 @@
+#include "intrusive_doubly_linked_list.hpp"
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_dlist_hook<T>& intrusive_doubly_linked_list<T, Hook>::hook(T& el){
+    return el.*Hook;
+};
+
+/**
+ * @brief Links el right before pos (nullptr means at the end). The caller must hold dll_mutex.
+ * @throw std::logic_error If el is already linked through this hook.
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::link_before(T* pos, T& el){
+    if(hook(el).owner) throw std::logic_error("Element already linked!");
+
+    T* before = pos ? hook(*pos).prev : tail;
+
+    hook(el).owner = this;
+    hook(el).prev = before;
+    hook(el).next = pos;
+
+    if(before) hook(*before).next = &el;
+    else head = &el;
+
+    if(pos) hook(*pos).prev = &el;
+    else tail = &el;
+
+    ++size;
+};
+
+/**
+ * @brief Unlinks el, which must belong to this list. The caller must hold dll_mutex.
+ * @throw std::invalid_argument If el is not linked into this list.
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::unlink(T& el){
+    if(hook(el).owner != this) throw std::invalid_argument("Element not linked into this list!");
+
+    T* before = hook(el).prev;
+    T* after = hook(el).next;
+
+    if(before) hook(*before).next = after;
+    else head = after;
+
+    if(after) hook(*after).prev = before;
+    else tail = before;
+
+    hook(el) = intrusive_dlist_hook<T>();
+    --size;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::unlink_all(){
+    while(head){
+        T* current = head;
+        head = hook(*head).next;
+        hook(*current) = intrusive_dlist_hook<T>();
+    }
+    tail = nullptr;
+    size = 0;
+};
+
+/**
+ * @brief Marks every element as owned by this list, after they were moved in from another one.
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::adopt_all(){
+    for(T* current = head; current; current = hook(*current).next) hook(*current).owner = this;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>::intrusive_doubly_linked_list() : size(0){};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>::intrusive_doubly_linked_list(intrusive_doubly_linked_list&& dll) : size(0){
+    std::lock_guard<std::mutex> lock(dll.dll_mutex);
+
+    head = dll.head;
+    tail = dll.tail;
+    size = dll.size.load();
+    adopt_all();
+
+    dll.head = dll.tail = nullptr;
+    dll.size = 0;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>::~intrusive_doubly_linked_list(){
+    clear();
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>& intrusive_doubly_linked_list<T, Hook>::operator=(intrusive_doubly_linked_list&& dll){
+    if(this != &dll){
+        std::lock(dll_mutex, dll.dll_mutex);
+        std::lock_guard<std::mutex> lock1(dll_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(dll.dll_mutex, std::adopt_lock);
+
+        unlink_all();
+
+        head = dll.head;
+        tail = dll.tail;
+        size = dll.size.load();
+        adopt_all();
+
+        dll.head = dll.tail = nullptr;
+        dll.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Links el at the end of the list without allocating.
+ * @throw std::logic_error If el is already linked through this hook.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>& intrusive_doubly_linked_list<T, Hook>::push_back(T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    link_before(nullptr, el);
+    return *this;
+};
+
+/**
+ * @brief Links el at the beginning of the list without allocating.
+ * @throw std::logic_error If el is already linked through this hook.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+intrusive_doubly_linked_list<T, Hook>& intrusive_doubly_linked_list<T, Hook>::push_front(T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    link_before(head, el);
+    return *this;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::pop_back(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(tail) unlink(*tail);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::pop_front(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(head) unlink(*head);
+};
+
+/**
+ * @brief Unlinks el from the list, wherever it is.
+ * @throw std::invalid_argument If el is not linked into this list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::erase(T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    unlink(el);
+};
+
+/**
+ * @brief Unlinks every element. The elements themselves are not destroyed.
+ * @complexity O(n)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+void intrusive_doubly_linked_list<T, Hook>::clear(){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    unlink_all();
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+T& intrusive_doubly_linked_list<T, Hook>::front() const{
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(!head) throw std::out_of_range("Out of range!");
+    return *head;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+T& intrusive_doubly_linked_list<T, Hook>::back() const{
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(!tail) throw std::out_of_range("Out of range!");
+    return *tail;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+size_t intrusive_doubly_linked_list<T, Hook>::get_size() const{
+    return size.load();
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+bool intrusive_doubly_linked_list<T, Hook>::empty() const{
+    return size.load() == 0;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+class intrusive_doubly_linked_list<T, Hook>::iterator{
+    private:
+        T* current;
+        friend class intrusive_doubly_linked_list<T, Hook>;
+    public:
+        explicit iterator(T* init) : current(init){};
+
+        T& operator*(){return *current;}
+        T* operator->(){return current;}
+        iterator& operator++(){
+            current = (current->*Hook).next;
+            return *this;
+        }
+        iterator operator++(int){
+            iterator tmp(*this);
+            current = (current->*Hook).next;
+            return tmp;
+        }
+        bool operator==(const iterator& it) const{return current == it.current;}
+        bool operator!=(const iterator& it) const{return current != it.current;}
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+class intrusive_doubly_linked_list<T, Hook>::const_iterator{
+    private:
+        const T* current;
+    public:
+        explicit const_iterator(const T* init) : current(init){};
+
+        const T& operator*() const{return *current;}
+        const T* operator->() const{return current;}
+        const_iterator& operator++(){
+            current = (current->*Hook).next;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator tmp(*this);
+            current = (current->*Hook).next;
+            return tmp;
+        }
+        bool operator==(const const_iterator& it) const{return current == it.current;}
+        bool operator!=(const const_iterator& it) const{return current != it.current;}
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+class intrusive_doubly_linked_list<T, Hook>::reverse_iterator{
+    private:
+        T* current;
+    public:
+        reverse_iterator(T* init) : current(init){};
+
+        T& operator*(){return *current;}
+        T* operator->(){return current;}
+        reverse_iterator& operator++(){
+            current = (current->*Hook).prev;
+            return *this;
+        }
+        reverse_iterator operator++(int){
+            reverse_iterator tmp(*this);
+            current = (current->*Hook).prev;
+            return tmp;
+        }
+        bool operator==(const reverse_iterator& it) const{return current == it.current;}
+        bool operator!=(const reverse_iterator& it) const{return current != it.current;}
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+class intrusive_doubly_linked_list<T, Hook>::const_reverse_iterator{
+    private:
+        const T* current;
+    public:
+        const_reverse_iterator(const T* init) : current(init){};
+
+        const T& operator*() const{return *current;}
+        const T* operator->() const{return current;}
+        const_reverse_iterator& operator++(){
+            current = (current->*Hook).prev;
+            return *this;
+        }
+        const_reverse_iterator operator++(int){
+            const_reverse_iterator tmp(*this);
+            current = (current->*Hook).prev;
+            return tmp;
+        }
+        bool operator==(const const_reverse_iterator& it) const{return current == it.current;}
+        bool operator!=(const const_reverse_iterator& it) const{return current != it.current;}
+};
+
+/**
+ * @brief Links el right before pos.
+ * @return An iterator to el.
+ * @throw std::logic_error If el is already linked through this hook.
+ * @throw std::invalid_argument If pos does not point into this list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::iterator intrusive_doubly_linked_list<T, Hook>::insert(iterator pos, T& el){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(pos.current && hook(*pos.current).owner != this) throw std::invalid_argument("Iterator does not belong to this list!");
+    link_before(pos.current, el);
+    return iterator(&el);
+};
+
+/**
+ * @brief Unlinks the element pointed by pos.
+ * @return An iterator to the element following the unlinked one.
+ * @throw std::invalid_argument If pos does not point into this list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::iterator intrusive_doubly_linked_list<T, Hook>::erase(iterator pos){
+    std::lock_guard<std::mutex> lock(dll_mutex);
+    if(!pos.current) throw std::invalid_argument("Element not linked into this list!");
+    T* following = hook(*pos.current).next;
+    unlink(*pos.current);
+    return iterator(following);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::iterator intrusive_doubly_linked_list<T, Hook>::begin(){
+    return iterator(head);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::iterator intrusive_doubly_linked_list<T, Hook>::end(){
+    return iterator(nullptr);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::const_iterator intrusive_doubly_linked_list<T, Hook>::begin() const{
+    return const_iterator(head);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::const_iterator intrusive_doubly_linked_list<T, Hook>::end() const{
+    return const_iterator(nullptr);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::reverse_iterator intrusive_doubly_linked_list<T, Hook>::rbegin(){
+    return reverse_iterator(tail);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::reverse_iterator intrusive_doubly_linked_list<T, Hook>::rend(){
+    return reverse_iterator(nullptr);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::const_reverse_iterator intrusive_doubly_linked_list<T, Hook>::crbegin() const{
+    return const_reverse_iterator(tail);
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+typename intrusive_doubly_linked_list<T, Hook>::const_reverse_iterator intrusive_doubly_linked_list<T, Hook>::crend() const{
+    return const_reverse_iterator(nullptr);
+};
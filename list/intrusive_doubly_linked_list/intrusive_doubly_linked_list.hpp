@@ -0,0 +1,90 @@
+#ifndef INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+#define INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * @file intrusive_doubly_linked_list.hpp
+ * @brief A thread-safe intrusive doubly linked list.
+ *
+ * The element type embeds one intrusive_dlist_hook per list it may belong to and the list only links
+ * existing objects, so no node is ever allocated and an element can be unlinked in O(1) from any list
+ * it belongs to. The list does not own the objects, which must outlive their membership.
+ * Each hook records the list it is linked into, so erasing an element of another list is rejected; moving
+ * a list therefore re-tags its elements in O(n).
+ *
+ * @tparam T Type of the elements.
+ * @tparam Hook Pointer to the hook member of T used by this list.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+struct intrusive_dlist_hook{
+    T* prev = nullptr;
+    T* next = nullptr;
+    const void* owner = nullptr;
+};
+
+template<typename T, intrusive_dlist_hook<T> T::* Hook>
+class intrusive_doubly_linked_list{
+    private:
+        T* head = nullptr;
+        T* tail = nullptr;
+        mutable std::mutex dll_mutex;
+        std::atomic<size_t> size;
+
+        static intrusive_dlist_hook<T>& hook(T& el);
+        void link_before(T* pos, T& el);
+        void unlink(T& el);
+        void unlink_all();
+        void adopt_all();
+
+    public:
+        using value_type = T;
+
+        intrusive_doubly_linked_list();
+        intrusive_doubly_linked_list(const intrusive_doubly_linked_list& dll) = delete;
+        intrusive_doubly_linked_list(intrusive_doubly_linked_list&& dll);
+        ~intrusive_doubly_linked_list();
+
+        intrusive_doubly_linked_list& operator=(const intrusive_doubly_linked_list& dll) = delete;
+        intrusive_doubly_linked_list& operator=(intrusive_doubly_linked_list&& dll);
+
+        intrusive_doubly_linked_list& push_back(T& el);
+        intrusive_doubly_linked_list& push_front(T& el);
+        void pop_back();
+        void pop_front();
+        void erase(T& el);
+        void clear();
+
+        T& front() const;
+        T& back() const;
+        size_t get_size() const;
+        bool empty() const;
+
+        class iterator;
+        class const_iterator;
+        class reverse_iterator;
+        class const_reverse_iterator;
+
+        iterator insert(iterator pos, T& el);
+        iterator erase(iterator pos);
+
+        iterator begin();
+        iterator end();
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        reverse_iterator rbegin();
+        reverse_iterator rend();
+
+        const_reverse_iterator crbegin() const;
+        const_reverse_iterator crend() const;
+};
+
+#endif
@@ -0,0 +1,352 @@
+#include "intrusive_singly_linked_list.hpp"
+
+/**
+ * @brief Returns the hook of el used by this list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_slist_hook<T>& intrusive_singly_linked_list<T, Hook>::hook(T& el){
+    return el.*Hook;
+};
+
+/**
+ * @brief Default constructor that initializes an empty list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>::intrusive_singly_linked_list() : head(nullptr), tail(nullptr), size(0){};
+
+/**
+ * @brief Move constructor. The linked objects are not touched, only the list ends change owner.
+ * @param l The list to move from.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>::intrusive_singly_linked_list(intrusive_singly_linked_list&& l) : size(0){
+    std::lock_guard<std::mutex> lock(l.l_mutex);
+
+    head = l.head;
+    tail = l.tail;
+    size = l.size.load();
+
+    l.head = l.tail = nullptr;
+    l.size = 0;
+};
+
+/**
+ * @brief Destructor that unlinks every element. The elements themselves are not destroyed.
+ * @complexity O(n), where n is the size of the list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>::~intrusive_singly_linked_list(){
+    clear();
+};
+
+/**
+ * @brief Move assignment operator. The elements previously linked here are unlinked.
+ * @param l The list to move from.
+ * @return Reference to the current list.
+ * @complexity O(n), where n is the size of the current list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>& intrusive_singly_linked_list<T, Hook>::operator=(intrusive_singly_linked_list&& l) noexcept{
+    if(this != &l){
+        std::lock(l_mutex, l.l_mutex);
+        std::lock_guard<std::mutex> lock1(l_mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(l.l_mutex, std::adopt_lock);
+
+        unlink_all();
+
+        head = l.head;
+        tail = l.tail;
+        size = l.size.load();
+
+        l.head = l.tail = nullptr;
+        l.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Links el at the end of the list. No memory is allocated.
+ * @param el The element to link.
+ * @return A reference to the modified list using a Fluent API style.
+ * @throw std::logic_error If el is already linked through this hook.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>& intrusive_singly_linked_list<T, Hook>::push_back(T& el){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    if(hook(el).linked) throw std::logic_error("Element already linked!");
+    hook(el).linked = true;
+    hook(el).next = nullptr;
+
+    if(!head) head = tail = &el;
+    else{
+        hook(*tail).next = &el;
+        tail = &el;
+    }
+    ++size;
+
+    return *this;
+};
+
+/**
+ * @brief Links el at the beginning of the list. No memory is allocated.
+ * @param el The element to link.
+ * @return A reference to the modified list using a Fluent API style.
+ * @throw std::logic_error If el is already linked through this hook.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+intrusive_singly_linked_list<T, Hook>& intrusive_singly_linked_list<T, Hook>::push_front(T& el){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    if(hook(el).linked) throw std::logic_error("Element already linked!");
+    hook(el).linked = true;
+    hook(el).next = head;
+
+    head = &el;
+    if(!tail) tail = &el;
+    ++size;
+
+    return *this;
+};
+
+/**
+ * @brief Unlinks the last element from the list.
+ * @complexity O(n), where n is the size of the list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+void intrusive_singly_linked_list<T, Hook>::pop_back(){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    if(!head) return;
+
+    T* last = tail;
+    if(head == tail) head = tail = nullptr;
+    else{
+        T* it = head;
+
+        while(hook(*it).next != tail) it = hook(*it).next;
+
+        tail = it;
+        hook(*tail).next = nullptr;
+    }
+    hook(*last) = intrusive_slist_hook<T>();
+    --size;
+};
+
+/**
+ * @brief Unlinks the first element from the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+void intrusive_singly_linked_list<T, Hook>::pop_front(){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    if(!head) return;
+
+    T* first = head;
+    head = hook(*head).next;
+    if(!head) tail = nullptr;
+
+    hook(*first) = intrusive_slist_hook<T>();
+    --size;
+};
+
+/**
+ * @brief Unlinks every element from the list.
+ * @complexity O(n), where n is the size of the list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+void intrusive_singly_linked_list<T, Hook>::clear(){
+    std::lock_guard<std::mutex> lock(l_mutex);
+    unlink_all();
+};
+
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+void intrusive_singly_linked_list<T, Hook>::unlink_all(){
+    T* current;
+
+    while(head){
+        current = head;
+        head = hook(*head).next;
+        hook(*current) = intrusive_slist_hook<T>();
+    }
+    tail = nullptr;
+    size = 0;
+};
+
+/**
+ * @brief Accesses the first element.
+ * @return Reference to the first element.
+ * @throw std::out_of_range If the list is empty.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+T& intrusive_singly_linked_list<T, Hook>::front() const{
+    std::lock_guard<std::mutex> lock(l_mutex);
+    if(!head) throw std::out_of_range("Out of range!");
+    return *head;
+};
+
+/**
+ * @brief Accesses the last element.
+ * @return Reference to the last element.
+ * @throw std::out_of_range If the list is empty.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+T& intrusive_singly_linked_list<T, Hook>::back() const{
+    std::lock_guard<std::mutex> lock(l_mutex);
+    if(!tail) throw std::out_of_range("Out of range!");
+    return *tail;
+};
+
+/**
+ * @brief Returns the current size of the list.
+ * @return The size of the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+size_t intrusive_singly_linked_list<T, Hook>::get_size() const{
+    return size;
+};
+
+/**
+ * @brief Checks if the list is empty.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+bool intrusive_singly_linked_list<T, Hook>::empty() const{
+    return size == 0;
+};
+
+/**
+ * @class iterator
+ * @brief Iterator for intrusive_singly_linked_list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+class intrusive_singly_linked_list<T, Hook>::iterator{
+    private:
+        T* current;
+
+    public:
+        using value_type = T;
+        using iterator_category = std::forward_iterator_tag;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() : current(nullptr){};
+        iterator(T* current_n) : current(current_n){};
+
+        pointer operator->() const{
+            return current;
+        }
+
+        reference operator*() const{
+            return *current;
+        }
+
+        iterator& operator++(){
+            if(current) current = (current->*Hook).next;
+            return *this;
+        }
+
+        iterator operator++(int){
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const {
+            return current == other.current;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return current != other.current;
+        }
+};
+
+/**
+ * @brief Constant iterator for intrusive_singly_linked_list.
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+class intrusive_singly_linked_list<T, Hook>::const_iterator{
+    private:
+        const T* current;
+
+    public:
+        using value_type = const T;
+        using iterator_category = std::forward_iterator_tag;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : current(nullptr){};
+        const_iterator(const T* current_n) : current(current_n){};
+
+        pointer operator->() const{
+            return current;
+        }
+
+        reference operator*() const{
+            return *current;
+        }
+
+        const_iterator& operator++(){
+            if(current) current = (current->*Hook).next;
+            return *this;
+        }
+
+        const_iterator operator++(int){
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return current == other.current;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return current != other.current;
+        }
+};
+
+/**
+ * @brief Returns an iterator pointing to the beginning of the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+typename intrusive_singly_linked_list<T, Hook>::iterator intrusive_singly_linked_list<T, Hook>::begin(){
+    return iterator(head);
+};
+
+/**
+ * @brief Returns an iterator pointing to the end of the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+typename intrusive_singly_linked_list<T, Hook>::iterator intrusive_singly_linked_list<T, Hook>::end(){
+    return iterator(nullptr);
+};
+
+/**
+ * @brief Returns a constant iterator pointing to the beginning of the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+typename intrusive_singly_linked_list<T, Hook>::const_iterator intrusive_singly_linked_list<T, Hook>::begin() const{
+    return const_iterator(head);
+};
+
+/**
+ * @brief Returns a constant iterator pointing to the end of the list.
+ * @complexity O(1)
+ */
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+typename intrusive_singly_linked_list<T, Hook>::const_iterator intrusive_singly_linked_list<T, Hook>::end() const{
+    return const_iterator(nullptr);
+};
@@ -0,0 +1,78 @@
+#ifndef INTRUSIVE_SINGLY_LINKED_LIST_HPP
+#define INTRUSIVE_SINGLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * @file intrusive_singly_linked_list.hpp
+ * @brief A thread-safe intrusive singly linked list.
+ *
+ * Unlike singly_linked_list, this list never allocates: the element type embeds one
+ * intrusive_slist_hook per list it may belong to, and the list only links existing objects.
+ * An object can therefore sit in several lists at once, one per hook member. The list does not own
+ * the objects, which must outlive their membership.
+ *
+ * @code
+ * struct session{
+ *     intrusive_slist_hook<session> by_age, by_user;
+ * };
+ * intrusive_singly_linked_list<session, &session::by_age> ages;
+ * @endcode
+ *
+ * @tparam T Type of the elements.
+ * @tparam Hook Pointer to the hook member of T used by this list.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+struct intrusive_slist_hook{
+    T* next = nullptr;
+    bool linked = false;
+};
+
+template<typename T, intrusive_slist_hook<T> T::* Hook>
+class intrusive_singly_linked_list{
+    private:
+        T* head;
+        T* tail;
+        std::atomic<size_t> size;
+        mutable std::mutex l_mutex;
+
+        static intrusive_slist_hook<T>& hook(T& el);
+        void unlink_all();
+
+    public:
+        intrusive_singly_linked_list();
+        intrusive_singly_linked_list(const intrusive_singly_linked_list& l) = delete;
+        intrusive_singly_linked_list(intrusive_singly_linked_list&& l);
+        ~intrusive_singly_linked_list();
+
+        intrusive_singly_linked_list& operator=(const intrusive_singly_linked_list& l) = delete;
+        intrusive_singly_linked_list& operator=(intrusive_singly_linked_list&& l) noexcept;
+
+        intrusive_singly_linked_list& push_back(T& el);
+        intrusive_singly_linked_list& push_front(T& el);
+        void pop_back();
+        void pop_front();
+        void clear();
+
+        T& front() const;
+        T& back() const;
+        size_t get_size() const;
+        bool empty() const;
+
+        class iterator;
+        class const_iterator;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
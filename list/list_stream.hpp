@@ -0,0 +1,151 @@
+#ifndef LIST_STREAM_HPP
+#define LIST_STREAM_HPP
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @file list_stream.hpp
+ * @brief Binary stream format shared by the write_to / read_from methods of the lists.
+ *
+ * A stream is a list_stream_header followed by chunks. Every chunk is a uint32_t element count followed
+ * by that many raw elements, and a chunk with count 0 terminates the stream. Chunks are sized to fit
+ * list_stream_chunk_bytes so that writers and readers only ever buffer one chunk, whatever the list length.
+ *
+ * @author Andrea Maggetto
+ */
+
+constexpr size_t list_stream_chunk_bytes = 64 * 1024;
+
+struct list_stream_header{
+    static constexpr char magic_value[8] = {'A', 'R', 'L', 'I', 'S', 'T', 'S', 'T'};
+    static constexpr uint32_t current_version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t type_size;
+
+    /**
+     * @brief Writes the header for elements of type_size bytes.
+     * @throw std::runtime_error If the stream fails.
+     */
+    static void write(std::ostream& os, uint32_t type_size){
+        list_stream_header h{};
+        std::memcpy(h.magic, magic_value, sizeof(magic_value));
+        h.version = current_version;
+        h.type_size = type_size;
+
+        os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        if(!os) throw std::runtime_error("List stream write failed!");
+    }
+
+    /**
+     * @brief Reads and validates the header for elements of type_size bytes.
+     * @throw std::runtime_error If the stream fails or holds another element type.
+     */
+    static void read(std::istream& is, uint32_t type_size){
+        list_stream_header h;
+        is.read(reinterpret_cast<char*>(&h), sizeof(h));
+
+        if(!is || std::memcmp(h.magic, magic_value, sizeof(magic_value)) != 0 ||
+           h.version != current_version || h.type_size != type_size){
+            throw std::runtime_error("Invalid list stream!");
+        }
+    }
+};
+
+/**
+ * @brief Number of elements of type T carried by a full chunk.
+ */
+template<typename T>
+constexpr uint32_t list_stream_chunk_elements(){
+    return sizeof(T) >= list_stream_chunk_bytes ? 1 : static_cast<uint32_t>(list_stream_chunk_bytes / sizeof(T));
+}
+
+/**
+ * @brief Staging buffer for one chunk, allocated as raw aligned bytes so that T needs no default constructor.
+ *
+ * Only trivially copyable types are streamed, and their objects are created implicitly in this storage by the
+ * copies and stream reads that fill it.
+ */
+template<typename T>
+class list_stream_buffer{
+    static_assert(std::is_trivially_copyable<T>::value, "list streams require a trivially copyable T");
+
+    T* data;
+
+    public:
+        list_stream_buffer() :
+            data(static_cast<T*>(::operator new(list_stream_chunk_elements<T>() * sizeof(T), std::align_val_t(alignof(T))))){}
+        ~list_stream_buffer(){
+            ::operator delete(data, std::align_val_t(alignof(T)));
+        }
+
+        list_stream_buffer(const list_stream_buffer& b) = delete;
+        list_stream_buffer& operator=(const list_stream_buffer& b) = delete;
+
+        T& operator[](size_t i){
+            return data[i];
+        }
+        T* get(){
+            return data;
+        }
+};
+
+/**
+ * @brief Writes count raw elements from buffer as one chunk.
+ * @throw std::runtime_error If the stream fails.
+ */
+template<typename T>
+void list_stream_write_chunk(std::ostream& os, const T* buffer, uint32_t count){
+    os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    os.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(count) * sizeof(T));
+    if(!os) throw std::runtime_error("List stream write failed!");
+}
+
+/**
+ * @brief Reads the next chunk into buffer, which must hold list_stream_chunk_elements<T>() elements.
+ * @return The number of elements read, 0 at the end of the stream.
+ * @throw std::runtime_error If the stream fails or the chunk is malformed.
+ */
+template<typename T>
+uint32_t list_stream_read_chunk(std::istream& is, T* buffer){
+    uint32_t count;
+    is.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if(!is || count > list_stream_chunk_elements<T>()) throw std::runtime_error("Invalid list stream!");
+
+    is.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(count) * sizeof(T));
+    if(!is) throw std::runtime_error("Truncated list stream!");
+
+    return count;
+}
+
+/**
+ * @brief Decodes a list stream chunk by chunk and calls f on every element, without building a list.
+ *
+ * Only one chunk is buffered at a time, so streams larger than the available memory can be consumed.
+ *
+ * @return The number of elements decoded.
+ * @throw std::runtime_error If the stream is invalid.
+ * @complexity O(n), where n is the number of elements in the stream.
+ */
+template<typename T, typename F>
+size_t list_stream_for_each(std::istream& is, F f){
+    list_stream_header::read(is, sizeof(T));
+
+    list_stream_buffer<T> buffer;
+    size_t total = 0;
+
+    for(uint32_t count; (count = list_stream_read_chunk(is, buffer.get())) != 0; total += count){
+        for(uint32_t i = 0; i < count; ++i) f(static_cast<const T&>(buffer[i]));
+    }
+
+    return total;
+}
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file node_pool.hpp
+ * @brief Chunked node allocator giving the lists a locality mode.
+ *
+ * A pool carves nodes out of 64 KiB chunks in address order, so nodes allocated one after the other are
+ * neighbours in memory and a traversal walks memory forwards instead of jumping around the heap. Freed nodes are
+ * recycled through a free list; the chunks are returned only when the pool dies.
+ *
+ * Every pooled node records its pool, so a node can be freed by any list, e.g. after a splice. A pool is
+ * reference counted by the lists using it and by its live nodes, and deletes itself when both drop to zero.
+ *
+ * Nodes record their pool in a member named pool, which is null for nodes allocated one by one. Both the chunks
+ * and the nodes allocated one by one come from Alloc. Alloc is default constructed wherever a node is freed, since
+ * a node may outlive its list, so it must be stateless like allocator and thread_cache_allocator.
+ *
+ * @tparam Node The node type of the list.
+ * @tparam Alloc The allocator of the list, rebound to the node slots.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename Node, typename Alloc = allocator<Node>>
+class node_pool{
+    private:
+        struct free_slot{
+            free_slot* next;
+        };
+
+        union slot{
+            free_slot free;
+            alignas(Node) unsigned char storage[sizeof(Node)];
+        };
+
+        using slot_allocator = typename Alloc::template rebind<slot>::other;
+
+        static constexpr size_t chunk_bytes = 64 * 1024;
+        static constexpr size_t slots_per_chunk = chunk_bytes / sizeof(slot) > 0 ? chunk_bytes / sizeof(slot) : 1;
+
+        std::mutex mtx_;
+        std::vector<slot*> chunks;
+        free_slot* free_list;
+        slot* bump;
+        slot* bump_end;
+        size_t live, refs;
+        slot_allocator alloc;
+
+        node_pool() : free_list(nullptr), bump(nullptr), bump_end(nullptr), live(0), refs(1){};
+        ~node_pool(){
+            for(slot* chunk : chunks) alloc.deallocate(chunk, slots_per_chunk);
+        };
+
+    public:
+        node_pool(const node_pool& p) = delete;
+        node_pool& operator=(const node_pool& p) = delete;
+
+        /**
+         * @brief Creates a pool referenced once by the caller.
+         * @complexity O(1)
+         */
+        static node_pool* create(){
+            return new node_pool();
+        }
+
+        /**
+         * @brief Adds a reference from a list.
+         * @complexity O(1)
+         */
+        void retain(){
+            std::lock_guard<std::mutex> lock(mtx_);
+            ++refs;
+        }
+
+        /**
+         * @brief Drops a reference from a list; the pool dies once no list and no node uses it.
+         * @complexity O(c), where c is the number of chunks, if the pool dies, O(1) otherwise.
+         */
+        void release(){
+            bool dead;
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                dead = --refs == 0 && live == 0;
+            }
+            if(dead) delete this;
+        }
+
+        /**
+         * @brief Returns uninitialized storage for one node: a recycled slot if any, otherwise the slot following
+         * the previously allocated one.
+         * @complexity O(1) amortized
+         */
+        void* allocate(){
+            std::lock_guard<std::mutex> lock(mtx_);
+            ++live;
+
+            if(free_list){
+                free_slot* recycled = free_list;
+                free_list = recycled->next;
+                return recycled;
+            }
+            if(bump == bump_end){
+                slot* chunk = alloc.allocate(slots_per_chunk);
+                chunks.push_back(chunk);
+                bump = chunk;
+                bump_end = chunk + slots_per_chunk;
+            }
+
+            return bump++;
+        }
+
+        /**
+         * @brief Gives back the storage of a destroyed node.
+         * @complexity O(1), or O(c) if the pool dies.
+         */
+        void deallocate(void* p){
+            bool dead;
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                free_slot* freed = static_cast<free_slot*>(p);
+                freed->next = free_list;
+                free_list = freed;
+                dead = --live == 0 && refs == 0;
+            }
+            if(dead) delete this;
+        }
+
+        /**
+         * @brief Returns uninitialized storage for one node outside any pool.
+         * @complexity O(1)
+         */
+        static void* allocate_unpooled(){
+            return slot_allocator().allocate(1);
+        }
+
+        /**
+         * @brief Gives back the storage of a destroyed node obtained from allocate_unpooled.
+         * @complexity O(1)
+         */
+        static void deallocate_unpooled(void* p){
+            slot_allocator().deallocate(static_cast<slot*>(p), 1);
+        }
+};
+
+/**
+ * @brief Constructs a node in pool, or on its own through the pool's Alloc if pool is null, and records where it
+ * lives.
+ *
+ * The node type must default its pool member to null and free itself through a destroying operator delete that
+ * calls destroy_pooled_node.
+ *
+ * @complexity O(1) amortized
+ */
+template<typename Node, typename Alloc, typename... Args>
+Node* make_pooled_node(node_pool<Node, Alloc>* pool, Args&&... args){
+    void* memory = pool ? pool->allocate() : node_pool<Node, Alloc>::allocate_unpooled();
+    Node* n;
+
+    try{
+        n = new (memory) Node(std::forward<Args>(args)...);
+    }
+    catch(...){
+        if(pool) pool->deallocate(memory);
+        else node_pool<Node, Alloc>::deallocate_unpooled(memory);
+        throw;
+    }
+
+    n->pool = pool;
+    return n;
+};
+
+/**
+ * @brief Destroys a node made by make_pooled_node and frees its storage where it came from.
+ * @complexity O(1)
+ */
+template<typename Node>
+void destroy_pooled_node(Node* n){
+    using pool_type = std::remove_pointer_t<decltype(n->pool)>;
+    pool_type* pool = n->pool;
+    n->~Node();
+
+    if(pool) pool->deallocate(n);
+    else pool_type::deallocate_unpooled(n);
+};
+
+/**
+ * @brief Hints the processor to fetch the cache line of p, which is about to be read.
+ */
+inline void prefetch_node(const void* p){
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#else
+    (void)p;
+#endif
+};
+
+#endif
@@ -0,0 +1,223 @@
+#include "persistent_singly_linked_list.hpp"
+
+template<typename T>
+persistent_singly_linked_list<T>::node::node(const T& value, node* tail) : info(value), next(tail), refs(1){};
+
+template<typename T>
+persistent_singly_linked_list<T>::persistent_singly_linked_list() = default;
+
+template<typename T>
+persistent_singly_linked_list<T>::persistent_singly_linked_list(node* h, size_t n) : head(h), size(n){};
+
+/**
+ * @brief Builds a list holding the elements of [first, last) in the same order.
+ * The nodes are linked front to back before the list is published, so a single pass suffices.
+ * @complexity O(n)
+ */
+template<typename T>
+template<typename InputIt>
+persistent_singly_linked_list<T>::persistent_singly_linked_list(InputIt first, InputIt last){
+    node** link = &head;
+    try{
+        for(; first != last; ++first, ++size){
+            *link = new node(*first, nullptr);
+            link = &(*link)->next;
+        }
+    }
+    catch(...){
+        release(head);
+        throw;
+    }
+};
+
+/**
+ * @brief Copy constructor. The copy shares every node of psll.
+ * @complexity O(1)
+ */
+template<typename T>
+persistent_singly_linked_list<T>::persistent_singly_linked_list(const persistent_singly_linked_list<T>& psll) : head(retain(psll.head)), size(psll.size){};
+
+template<typename T>
+persistent_singly_linked_list<T>::persistent_singly_linked_list(persistent_singly_linked_list<T>&& psll) noexcept : head(psll.head), size(psll.size){
+    psll.head = nullptr;
+    psll.size = 0;
+};
+
+/**
+ * @brief Destructor. Frees the nodes no other version uses, without recursing along the chain.
+ * @complexity O(k), where k is the number of nodes only this version used
+ */
+template<typename T>
+persistent_singly_linked_list<T>::~persistent_singly_linked_list(){
+    release(head);
+};
+
+template<typename T>
+persistent_singly_linked_list<T>& persistent_singly_linked_list<T>::operator=(const persistent_singly_linked_list<T>& psll){
+    node* old = head;
+    head = retain(psll.head);
+    size = psll.size;
+    release(old);
+    return *this;
+};
+
+template<typename T>
+persistent_singly_linked_list<T>& persistent_singly_linked_list<T>::operator=(persistent_singly_linked_list<T>&& psll) noexcept{
+    if(this != &psll){
+        release(head);
+        head = psll.head;
+        size = psll.size;
+        psll.head = nullptr;
+        psll.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Compares the elements, stopping as soon as both versions reach a shared node.
+ * @complexity O(n) at most
+ */
+template<typename T>
+bool persistent_singly_linked_list<T>::operator==(const persistent_singly_linked_list<T>& psll) const{
+    if(size != psll.size) return false;
+
+    for(const node *a = head, *b = psll.head; a != b; a = a->next, b = b->next){
+        if(a->info != b->info) return false;
+    }
+    return true;
+};
+
+template<typename T>
+bool persistent_singly_linked_list<T>::operator!=(const persistent_singly_linked_list<T>& psll) const{
+    return !(*this == psll);
+};
+
+/**
+ * @brief Returns a new version with el in front of the elements of this one, which it shares.
+ * @complexity O(1)
+ */
+template<typename T>
+persistent_singly_linked_list<T> persistent_singly_linked_list<T>::push_front(const T& el) const{
+    node* added = new node(el, head);
+    retain(head);
+    return persistent_singly_linked_list<T>(added, size + 1);
+};
+
+/**
+ * @brief Returns a new version without the first element, sharing all the others.
+ * @throw std::out_of_range If the list is empty.
+ * @complexity O(1)
+ */
+template<typename T>
+persistent_singly_linked_list<T> persistent_singly_linked_list<T>::pop_front() const{
+    if(!head) throw std::out_of_range("Out of range!");
+    return persistent_singly_linked_list<T>(retain(head->next), size - 1);
+};
+
+/**
+ * @brief Returns a new version holding the elements in reverse order. Nothing can be shared, so every node is new.
+ * @complexity O(n)
+ */
+template<typename T>
+persistent_singly_linked_list<T> persistent_singly_linked_list<T>::reverse() const{
+    persistent_singly_linked_list<T> reversed;
+    for(const node* it = head; it != nullptr; it = it->next){
+        reversed.head = new node(it->info, reversed.head);
+        ++reversed.size;
+    }
+    return reversed;
+};
+
+/**
+ * @brief Returns the first element.
+ * @throw std::out_of_range If the list is empty.
+ * @complexity O(1)
+ */
+template<typename T>
+const T& persistent_singly_linked_list<T>::front() const{
+    if(!head) throw std::out_of_range("Out of range!");
+    return head->info;
+};
+
+template<typename T>
+size_t persistent_singly_linked_list<T>::get_size() const{
+    return size;
+};
+
+template<typename T>
+bool persistent_singly_linked_list<T>::empty() const{
+    return size == 0;
+};
+
+template<typename T>
+class persistent_singly_linked_list<T>::const_iterator{
+    private:
+        const node* current;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        explicit const_iterator(const node* init) : current(init){};
+
+        const T& operator*() const{return current->info;}
+        const T* operator->() const{return &current->info;}
+        const_iterator& operator++(){
+            current = current->next;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator tmp(*this);
+            current = current->next;
+            return tmp;
+        }
+        bool operator==(const const_iterator& it) const{
+            return current == it.current;
+        }
+        bool operator!=(const const_iterator& it) const{
+            return current != it.current;
+        }
+};
+
+template<typename T>
+typename persistent_singly_linked_list<T>::const_iterator persistent_singly_linked_list<T>::begin() const{
+    return const_iterator(head);
+};
+
+template<typename T>
+typename persistent_singly_linked_list<T>::const_iterator persistent_singly_linked_list<T>::end() const{
+    return const_iterator(nullptr);
+};
+
+template<typename T>
+typename persistent_singly_linked_list<T>::node* persistent_singly_linked_list<T>::retain(node* n){
+    if(n) n->refs.fetch_add(1, std::memory_order_relaxed);
+    return n;
+};
+
+/**
+ * @brief Drops one reference to n and frees the nodes whose last reference goes away, walking down the chain.
+ * The acquire-release decrement makes every write to a node happen before its deletion by another thread.
+ */
+template<typename T>
+void persistent_singly_linked_list<T>::release(node* n){
+    while(n && n->refs.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        node* next = n->next;
+        delete n;
+        n = next;
+    }
+};
+
+template<typename T>
+std::ostream& operator<<(std::ostream& os, const persistent_singly_linked_list<T>& l){
+    os << "[";
+    bool first = true;
+    for(const T& el : l){
+        if(!first) os << ", ";
+        os << el;
+        first = false;
+    }
+    return os << "]";
+};
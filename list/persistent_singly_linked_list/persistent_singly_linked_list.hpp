@@ -0,0 +1,74 @@
+#ifndef PERSISTENT_SINGLY_LINKED_LIST_HPP
+#define PERSISTENT_SINGLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+
+/**
+ * @file persistent_singly_linked_list.hpp
+ * @brief An immutable singly linked list whose versions share their common tails.
+ *
+ * A list value never changes: push_front and pop_front return a new version that shares every node of the old
+ * one, so copying a version is O(1) and handing it to another thread costs one reference count increment.
+ * Nodes carry an atomic reference count and are freed, iteratively, when the last version using them goes away.
+ * Reading a version takes no lock at all, since nothing reachable from it is ever modified.
+ *
+ * As with std::shared_ptr, a single list object must not be assigned from one thread while another thread
+ * uses it; distinct copies can be used freely from different threads.
+ *
+ * @tparam T Type of the elements.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class persistent_singly_linked_list{
+    private:
+        struct node{
+            T info;
+            node* next;
+            std::atomic<size_t> refs;
+            node(const T& value, node* tail);
+        };
+
+        node* head = nullptr;
+        size_t size = 0;
+
+        persistent_singly_linked_list(node* h, size_t n);
+        static node* retain(node* n);
+        static void release(node* n);
+
+    public:
+        using value_type = T;
+
+        class const_iterator;
+
+        persistent_singly_linked_list();
+        template<typename InputIt>
+        persistent_singly_linked_list(InputIt first, InputIt last);
+        persistent_singly_linked_list(const persistent_singly_linked_list<T>& psll);
+        persistent_singly_linked_list(persistent_singly_linked_list<T>&& psll) noexcept;
+        ~persistent_singly_linked_list();
+
+        persistent_singly_linked_list<T>& operator=(const persistent_singly_linked_list<T>& psll);
+        persistent_singly_linked_list<T>& operator=(persistent_singly_linked_list<T>&& psll) noexcept;
+
+        bool operator==(const persistent_singly_linked_list<T>& psll) const;
+        bool operator!=(const persistent_singly_linked_list<T>& psll) const;
+
+        persistent_singly_linked_list<T> push_front(const T& el) const;
+        persistent_singly_linked_list<T> pop_front() const;
+        persistent_singly_linked_list<T> reverse() const;
+        const T& front() const;
+
+        size_t get_size() const;
+        bool empty() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
@@ -6,24 +6,32 @@
  * @param value The value to be stored in the node.
  * @complexity O(1)
  */
-template<typename T>
-singly_linked_list<T>::node::node(const T& value) : info(value), next(nullptr){};
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::node::node(const T& value) : info(value), next(nullptr){};
+
+/**
+ * @brief Constructor that initializes a node by moving a value into it.
+ * @param value The value to be stored in the node.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::node::node(T&& value) : info(std::move(value)), next(nullptr){};
 
 /**
  * @brief Default constructor that initializes an empty list.
  * @complexity O(1)
  */
-template<typename T>
-singly_linked_list<T>::singly_linked_list() : head(nullptr), tail(nullptr), size(0){};
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::singly_linked_list() : head(nullptr), tail(nullptr), size(0), pool(nullptr), prefetch_distance(0){};
 
 
 /**
- * @brief Copy constructor.
+ * @brief Copy constructor. The copy inherits the locality settings of l, with its own chunks.
  * @param l The list to copy from.
  * @complexity O(n), where n is the size of list l.
  */
-template<typename T>
-singly_linked_list<T>::singly_linked_list(const singly_linked_list<T>& l){
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::singly_linked_list(const singly_linked_list<T, Alloc>& l) : head(nullptr), tail(nullptr), size(0), pool(l.pool ? node_pool<node, Alloc>::create() : nullptr), prefetch_distance(l.prefetch_distance){
     node* it = l.head;
 
     while(it){
@@ -38,9 +46,10 @@ singly_linked_list<T>::singly_linked_list(const singly_linked_list<T>& l){
  * @param l The list to move from.
  * @complexity O(1)
  */
-template<typename T>
-singly_linked_list<T>::singly_linked_list(singly_linked_list<T>&& l) : head(l.head), tail(l.tail), size(l.size){
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::singly_linked_list(singly_linked_list<T, Alloc>&& l) : head(l.head), tail(l.tail), size(l.size.load()), pool(l.pool), prefetch_distance(l.prefetch_distance){
     l.head = l.tail = nullptr;
+    l.pool = nullptr;
     l.size = 0;
 };
 
@@ -49,9 +58,10 @@ singly_linked_list<T>::singly_linked_list(singly_linked_list<T>&& l) : head(l.he
  * @brief Destructor that clears the list.
  * @complexity O(n), where n is the size of the list.
  */
-template<typename T>
-singly_linked_list<T>::~singly_linked_list(){
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>::~singly_linked_list(){
     clear();
+    if(pool) pool->release();
 };
 
 /**
@@ -60,8 +70,8 @@ singly_linked_list<T>::~singly_linked_list(){
  * @return Reference to the current list.
  * @complexity O(n + m), where n is the size of the current list and m is the size of list l.
  */
-template<typename T>
-singly_linked_list<T>& singly_linked_list<T>::operator=(const singly_linked_list<T>& l) noexcept{
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>& singly_linked_list<T, Alloc>::operator=(const singly_linked_list<T, Alloc>& l) noexcept{
     if(this != &l){
         clear();
 
@@ -81,16 +91,21 @@ singly_linked_list<T>& singly_linked_list<T>::operator=(const singly_linked_list
  * @return Reference to the current list.
  * @complexity O(n), where n is the size of the current list.
  */
-template<typename T>
-singly_linked_list<T>& singly_linked_list<T>::operator=(singly_linked_list<T>&& l) noexcept{
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>& singly_linked_list<T, Alloc>::operator=(singly_linked_list<T, Alloc>&& l) noexcept{
     if(this != &l){
         clear();
+        if(pool) pool->release();
 
         head = l.head;
         tail = l.tail;
-        size = l.size;
+        size = l.size.load();
+        pool = l.pool;
+        prefetch_distance = l.prefetch_distance;
 
         l.head = l.tail = nullptr;
+        l.pool = nullptr;
+        l.size = 0;
     }
     return *this;
 };
@@ -107,18 +122,10 @@ singly_linked_list<T>& singly_linked_list<T>::operator=(singly_linked_list<T>&&
  * 
  * @complexity O(1)
  */
-template<typename T>
-singly_linked_list<T> singly_linked_list<T>::push_back(const T& value){      
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>& singly_linked_list<T, Alloc>::push_back(const T& value){      
     std::lock_guard<std::mutex> lock(l_mutex);
-
-    node* to_add = new node(value);
-
-    if(!head) head = tail = to_add;
-    else{
-        tail->next = to_add;
-        tail = tail->next;
-    }
-    ++size;
+    push_back_unlocked(value);
 
     return *this;
 };
@@ -135,10 +142,14 @@ singly_linked_list<T> singly_linked_list<T>::push_back(const T& value){
  * 
  * @complexity O(1)
  */
-template<typename T>
-void singly_linked_list<T>::pop_back(){
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::pop_back(){
     std::lock_guard<std::mutex> lock(l_mutex);
+    pop_back_unlocked();
+};
 
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::pop_back_unlocked(){
     if(!head) return;
     if(head == tail){
         delete tail;
@@ -161,11 +172,17 @@ void singly_linked_list<T>::pop_back(){
  * @param value The value to add.
  * @complexity O(1)
  */
-template<typename T>
-singly_linked_list<T> singly_linked_list<T>::push_front(const T& value){
+template<typename T, typename Alloc>
+singly_linked_list<T, Alloc>& singly_linked_list<T, Alloc>::push_front(const T& value){
     std::lock_guard<std::mutex> lock(l_mutex);
+    push_front_unlocked(value);
+
+    return *this;
+};
 
-    node* to_add = new node(value);
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::push_front_unlocked(const T& value){
+    node* to_add = make_node(value, pool);
 
     if(!head) head = tail = to_add;
     else{
@@ -173,18 +190,20 @@ singly_linked_list<T> singly_linked_list<T>::push_front(const T& value){
         head = to_add;
     }
     ++size;
-
-    return *this;
 };
 
 /**
  * @brief Removes the first element from the list.
  * @complexity O(1)
  */
-template<typename T>
-void singly_linked_list<T>::pop_front(){
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::pop_front(){
     std::lock_guard<std::mutex> lock(l_mutex);
+    pop_front_unlocked();
+};
 
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::pop_front_unlocked(){
     if(!head) return;
     
     if(head == tail){
@@ -200,6 +219,161 @@ void singly_linked_list<T>::pop_front(){
     --size;
 };
 
+/**
+ * @brief Appends the value without locking. The caller must hold l_mutex.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::push_back_unlocked(const T& value){
+    node* to_add = make_node(value, pool);
+
+    if(!head) head = tail = to_add;
+    else{
+        tail->next = to_add;
+        tail = tail->next;
+    }
+    ++size;
+};
+
+/**
+ * @brief Appends n values read from first with a single lock acquisition.
+ * 
+ * The nodes are allocated and chained before taking the lock, which is then held only for one relink.
+ * 
+ * @param first Iterator to the first value to append.
+ * @param n The number of values to append.
+ * @return A reference to the modified list using a Fluent API style.
+ * 
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+template<typename InputIt>
+singly_linked_list<T, Alloc>& singly_linked_list<T, Alloc>::push_back_n(InputIt first, size_t n){
+    if(n == 0) return *this;
+
+    node_pool<node, Alloc>* from = retain_pool();
+    node* chain_head = make_node(*first, from);
+    node* chain_tail = chain_head;
+
+    for(size_t i = 1; i < n; ++i){
+        ++first;
+        chain_tail->next = make_node(*first, from);
+        chain_tail = chain_tail->next;
+    }
+    if(from) from->release();
+
+    std::lock_guard<std::mutex> lock(l_mutex);
+    if(!head) head = chain_head;
+    else tail->next = chain_head;
+    tail = chain_tail;
+    size += n;
+
+    return *this;
+};
+
+/**
+ * @brief Removes up to n elements from the front of the list, moving their values into out.
+ * 
+ * The elements are detached with a single lock acquisition, then moved out and freed without holding the lock.
+ * 
+ * @param out Output iterator receiving the removed values, in list order.
+ * @param n The maximum number of elements to remove.
+ * @return The number of elements removed.
+ * 
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+template<typename OutputIt>
+size_t singly_linked_list<T, Alloc>::pop_front_n(OutputIt out, size_t n){
+    node* chain = nullptr;
+    size_t removed = 0;
+    {
+        std::lock_guard<std::mutex> lock(l_mutex);
+        if(!head || n == 0) return 0;
+
+        chain = head;
+        node* last = head;
+        for(removed = 1; removed < n && last->next; ++removed) last = last->next;
+
+        head = last->next;
+        last->next = nullptr;
+        if(!head) tail = nullptr;
+        size -= removed;
+    }
+
+    while(chain){
+        node* current = chain;
+        chain = chain->next;
+        *out = std::move(current->info);
+        ++out;
+        delete current;
+    }
+
+    return removed;
+};
+
+/**
+ * @brief Removes up to n elements from the front of the list with a single lock acquisition.
+ * @param n The maximum number of elements to remove.
+ * @return The number of elements removed.
+ * @complexity O(n)
+ */
+template<typename T, typename Alloc>
+size_t singly_linked_list<T, Alloc>::pop_front_n(size_t n){
+    struct discard{
+        discard& operator*(){ return *this; }
+        discard& operator++(){ return *this; }
+        discard& operator=(T&&){ return *this; }
+    };
+    return pop_front_n(discard(), n);
+};
+
+/**
+ * @brief Locks the list once and returns a handle exposing unlocked operations.
+ * 
+ * The lock is held until the handle is destroyed. Using the list directly from the same thread while the
+ * handle is alive deadlocks.
+ * 
+ * @return The batch handle.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::batch singly_linked_list<T, Alloc>::lock_batch(){
+    return batch(*this);
+};
+
+/**
+ * @class batch
+ * @brief Scoped batch handle holding the list lock for its whole lifetime.
+ */
+template<typename T, typename Alloc>
+class singly_linked_list<T, Alloc>::batch{
+    private:
+        singly_linked_list<T, Alloc>* owner;
+        std::unique_lock<std::mutex> lock;
+
+    public:
+        explicit batch(singly_linked_list<T, Alloc>& l) : owner(&l), lock(l.l_mutex){};
+
+        batch& push_back(const T& value){
+            owner->push_back_unlocked(value);
+            return *this;
+        }
+        batch& push_front(const T& value){
+            owner->push_front_unlocked(value);
+            return *this;
+        }
+        void pop_back(){
+            owner->pop_back_unlocked();
+        }
+        void pop_front(){
+            owner->pop_front_unlocked();
+        }
+        size_t get_size() const{
+            return owner->size;
+        }
+};
+
 /**
  * @brief Searches for a value in the list.
  * @param value The value to search for.
@@ -207,8 +381,8 @@ void singly_linked_list<T>::pop_front(){
  * @throw std::runtime_error If the value is not found.
  * @complexity O(n), where n is the size of the list.
  */
-template<typename T>
-const T& singly_linked_list<T>::search(const T& value) const{ 
+template<typename T, typename Alloc>
+const T& singly_linked_list<T, Alloc>::search(const T& value) const{ 
     std::lock_guard<std::mutex> lock(l_mutex);
 
     node* it = head;
@@ -226,19 +400,195 @@ const T& singly_linked_list<T>::search(const T& value) const{
  * @return The size of the list.
  * @complexity O(1)
  */
-template<typename T>
-size_t singly_linked_list<T>::get_size() const{
+template<typename T, typename Alloc>
+size_t singly_linked_list<T, Alloc>::get_size() const{
     return size;
 };
 
+/**
+ * @brief Writes the list to a binary stream in the list_stream format.
+ * 
+ * Elements are gathered into a fixed-size chunk buffer and written with one write per chunk, so the
+ * extra memory is bounded whatever the size of the list. The list is locked for the whole write.
+ * 
+ * @param os The output stream, which should be opened in binary mode.
+ * @throw std::runtime_error If the stream fails.
+ * @complexity O(n), where n is the size of the list.
+ */
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::write_to(std::ostream& os) const{
+    static_assert(std::is_trivially_copyable<T>::value, "write_to requires a trivially copyable T");
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    const uint32_t chunk = list_stream_chunk_elements<T>();
+    list_stream_buffer<T> buffer;
+    uint32_t count = 0;
+
+    list_stream_header::write(os, sizeof(T));
+    for(node* it = head; it; it = it->next){
+        buffer[count++] = it->info;
+        if(count == chunk){
+            list_stream_write_chunk(os, buffer.get(), count);
+            count = 0;
+        }
+    }
+    if(count) list_stream_write_chunk(os, buffer.get(), count);
+    list_stream_write_chunk(os, buffer.get(), 0);
+};
+
+/**
+ * @brief Appends the elements of a binary stream written by write_to.
+ * 
+ * The whole stream is decoded into a detached chain without holding the lock and then appended with a
+ * single locked relink, so the list is left untouched if any chunk is invalid.
+ * 
+ * @param is The input stream, which should be opened in binary mode.
+ * @return The number of elements appended.
+ * @throw std::runtime_error If the stream is invalid.
+ * @complexity O(n), where n is the number of elements in the stream.
+ */
+template<typename T, typename Alloc>
+size_t singly_linked_list<T, Alloc>::read_from(std::istream& is){
+    static_assert(std::is_trivially_copyable<T>::value, "read_from requires a trivially copyable T");
+
+    list_stream_header::read(is, sizeof(T));
+
+    list_stream_buffer<T> buffer;
+    node* first = nullptr;
+    node* last = nullptr;
+    size_t total = 0;
+
+    node_pool<node, Alloc>* from = retain_pool();
+    try{
+        for(uint32_t count; (count = list_stream_read_chunk(is, buffer.get())) != 0; total += count){
+            for(uint32_t i = 0; i < count; ++i){
+                node* to_add = make_node(buffer[i], from);
+                if(last) last->next = to_add;
+                else first = to_add;
+                last = to_add;
+            }
+        }
+    }
+    catch(...){
+        while(first){
+            node* current = first;
+            first = first->next;
+            delete current;
+        }
+        if(from) from->release();
+        throw;
+    }
+    if(from) from->release();
+
+    if(first){
+        std::lock_guard<std::mutex> lock(l_mutex);
+        if(!head) head = first;
+        else tail->next = first;
+        tail = last;
+        size += total;
+    }
+
+    return total;
+};
+
+/**
+ * @brief Enables or disables locality mode for the nodes allocated from now on.
+ * 
+ * When enabled, new nodes are carved in address order out of chunks owned by the list instead of being
+ * allocated one by one on the heap. Existing nodes are left where they are; compact() moves them.
+ * 
+ * @param enabled Whether new nodes come from the list chunks.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::set_locality(bool enabled){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    if(enabled && !pool) pool = node_pool<node, Alloc>::create();
+    else if(!enabled && pool){
+        pool->release();
+        pool = nullptr;
+    }
+};
+
+/**
+ * @brief Sets how many nodes ahead of the current one the iterators prefetch, 0 disabling prefetching.
+ * 
+ * On every increment a prefetching iterator walks distance nodes from its new position and prefetches the node
+ * it reaches, so the cache miss of a node overlaps with the work done on the previous distance nodes. The walk
+ * goes over nodes already in the cache and only ever follows links from the current node, which stays valid
+ * while the nodes ahead of it are erased. It makes an increment O(d), which only pays off on scattered nodes:
+ * after compact() the hardware prefetcher already follows the pool.
+ * 
+ * @param distance The prefetch distance of the iterators created from now on.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::set_prefetch_distance(size_t distance){
+    std::lock_guard<std::mutex> lock(l_mutex);
+    prefetch_distance = distance;
+};
+
+/**
+ * @brief Moves the elements into fresh nodes laid out sequentially in list order, and enables locality mode.
+ * 
+ * After heavy churn the nodes are scattered over the heap (or over the recycled slots of the list chunks);
+ * compacting allocates a new set of chunks, moves the elements there in list order and frees the old nodes,
+ * so that a traversal walks memory forwards again. Iterators and references are invalidated.
+ * 
+ * @complexity O(n), where n is the size of the list.
+ */
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::compact(){
+    std::lock_guard<std::mutex> lock(l_mutex);
+
+    node_pool<node, Alloc>* fresh = node_pool<node, Alloc>::create();
+    node* new_head = nullptr;
+    node* new_tail = nullptr;
+
+    try{
+        for(node* it = head; it; it = it->next){
+            node* moved = make_pooled_node(fresh, std::move_if_noexcept(it->info));
+            if(new_tail) new_tail->next = moved;
+            else new_head = moved;
+            new_tail = moved;
+        }
+    }
+    catch(...){
+        while(new_head){
+            node* current = new_head;
+            new_head = new_head->next;
+            delete current;
+        }
+        fresh->release();
+        throw;
+    }
+
+    while(head){
+        node* current = head;
+        head = head->next;
+        delete current;
+    }
+    if(pool) pool->release();
+
+    head = new_head;
+    tail = new_tail;
+    pool = fresh;
+};
+
 /**
  * @class iterator
  * @brief Iterator for singly_linked_list.
+ * 
+ * With a non-zero prefetch distance every increment walks that many nodes ahead of the new position and
+ * prefetches the node it reaches, so that the dependent load of every next pointer is served from the cache.
+ * The walk starts from the current node each time, since a node ahead may be erased while the iterator is live.
  */
-template<typename T>
-class singly_linked_list<T>::iterator{
+template<typename T, typename Alloc>
+class singly_linked_list<T, Alloc>::iterator{
     private:
         node* current;
+        size_t distance;
     
     public:
         using value_type = T;
@@ -246,19 +596,25 @@ class singly_linked_list<T>::iterator{
         using pointer = T*;
         using reference = T&;
 
-        iterator() : current(nullptr){};
-        iterator(const node* current_n) : current(current_n){};
+        iterator() : current(nullptr), distance(0){};
+        iterator(node* current_n, size_t distance = 0) : current(current_n), distance(distance){};
         
         pointer operator->() const{
-            return current->info;
+            return &current->info;
         }
 
         reference operator*() const{
-            return &current->info;
+            return current->info;
         }
 
         iterator& operator++(){
             if(current) current = current->next;
+            if(distance && current){
+                //walked from current on every step: a node farther ahead may have been erased since
+                const node* target = current;
+                for(size_t i = 0; i < distance && target; ++i) target = target->next;
+                if(target) prefetch_node(target);
+            }
             return *this;
         }
 
@@ -282,47 +638,54 @@ class singly_linked_list<T>::iterator{
  * 
  * This iterator is designed to safely iterate over a singly_linked_list without allowing
  * modifications to the elements it references. This ensures that the list's
- * integrity remains intact during iterations.
+ * integrity remains intact during iterations. It prefetches like iterator.
  * 
  * @tparam T The type of elements in the singly_linked_list.
  */
-template<typename T>
-class singly_linked_list<T>::const_iterator{
+template<typename T, typename Alloc>
+class singly_linked_list<T, Alloc>::const_iterator{
     private:
-        node* current;
+        const node* current;
+        size_t distance;
     public:
         using value_type = const T;
         using iterator_category = std::forward_iterator_tag;
         using pointer = const T*;
         using reference = const T&;
 
-        const_iterator() : current(nullptr){};
-        const_iterator(const node* current_n) : current(current_n){};
+        const_iterator() : current(nullptr), distance(0){};
+        const_iterator(const node* current_n, size_t distance = 0) : current(current_n), distance(distance){};
         
         pointer operator->() const{
-            return current->info;
+            return &current->info;
         }
 
         reference operator*() const{
-            return &current->info;
+            return current->info;
         }
 
         const_iterator& operator++(){
             if(current) current = current->next;
+            if(distance && current){
+                //walked from current on every step: a node farther ahead may have been erased since
+                const node* target = current;
+                for(size_t i = 0; i < distance && target; ++i) target = target->next;
+                if(target) prefetch_node(target);
+            }
             return *this;
         }
 
         const_iterator operator++(int){
-            iterator tmp = *this;
+            const_iterator tmp = *this;
             ++(*this);
             return tmp;
         }
 
-        bool operator==(const iterator& other) const {
+        bool operator==(const const_iterator& other) const {
             return current == other.current;
         }
 
-        bool operator!=(const iterator& other) const {
+        bool operator!=(const const_iterator& other) const {
             return current != other.current;
         }
 };
@@ -332,9 +695,9 @@ class singly_linked_list<T>::const_iterator{
  * @return Iterator to the beginning.
  * @complexity O(1)
  */
-template<typename T>
-typename singly_linked_list<T>::iterator singly_linked_list<T>::begin(){
-    return iterator(head);
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::iterator singly_linked_list<T, Alloc>::begin(){
+    return iterator(head, prefetch_distance);
 };
 
 /**
@@ -342,17 +705,37 @@ typename singly_linked_list<T>::iterator singly_linked_list<T>::begin(){
  * @return Iterator to the end.
  * @complexity O(1)
  */
-template<typename T>
-typename singly_linked_list<T>::iterator singly_linked_list<T>::end(){
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::iterator singly_linked_list<T, Alloc>::end(){
     return iterator(nullptr);
 };
 
+/**
+ * @brief Returns a constant iterator pointing to the beginning of the list.
+ * @return Constant iterator to the beginning.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::const_iterator singly_linked_list<T, Alloc>::begin() const{
+    return const_iterator(head, prefetch_distance);
+};
+
+/**
+ * @brief Returns a constant iterator pointing to the end of the list.
+ * @return Constant iterator to the end.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::const_iterator singly_linked_list<T, Alloc>::end() const{
+    return const_iterator(nullptr);
+};
+
 /**
  * @brief Clears all elements from the list.
  * @complexity O(n), where n is the size of the list.
  */
-template<typename T>
-void singly_linked_list<T>::clear(){
+template<typename T, typename Alloc>
+void singly_linked_list<T, Alloc>::clear(){
     std::lock_guard<std::mutex> lock(l_mutex);
     node* current;
 
@@ -365,4 +748,23 @@ void singly_linked_list<T>::clear(){
     size = 0;
 };
 
+/**
+ * @brief Builds a node in the given pool, or on the heap if from is null.
+ * @complexity O(1) amortized
+ */
+template<typename T, typename Alloc>
+typename singly_linked_list<T, Alloc>::node* singly_linked_list<T, Alloc>::make_node(const T& value, node_pool<node, Alloc>* from){
+    return make_pooled_node(from, value);
+};
 
+/**
+ * @brief Returns the pool of the list with an extra reference, so that nodes can be built without holding
+ * l_mutex while compact() or set_locality() swap the pool. The caller must release it.
+ * @complexity O(1)
+ */
+template<typename T, typename Alloc>
+node_pool<typename singly_linked_list<T, Alloc>::node, Alloc>* singly_linked_list<T, Alloc>::retain_pool(){
+    std::lock_guard<std::mutex> lock(l_mutex);
+    if(pool) pool->retain();
+    return pool;
+};
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <mutex>
 #include <atomic>
+#include <type_traits>
+#include <new>
+#include "../list_stream.hpp"
+#include "../node_pool.hpp"
 
 /**
  * @file singly_linked_list.hpp
@@ -9,48 +13,85 @@
  * This list provides basic operations like push_back, pop_back, push_front, and pop_front.
  * It is designed to be thread-safe using mutexes.
  * 
+ * In locality mode (set_locality) the nodes are carved in address order out of chunks owned by the list, the
+ * iterators prefetch the node prefetch_distance steps ahead, and compact() moves the elements into fresh,
+ * sequential nodes after heavy churn.
+ * 
  * @tparam T Type of the elements.
+ * @tparam Alloc The stateless allocator the nodes and the locality chunks come from.
  * 
  * @author Andrea Maggetto
  */
 
-template<typename T>
+template<typename T, typename Alloc = allocator<T>>
 class singly_linked_list{
     private:
         struct node{
             T info;
             node* next;
+            node_pool<node, Alloc>* pool = nullptr;
             node(const T& value);
+            node(T&& value);
+
+            static void operator delete(node* n, std::destroying_delete_t){
+                destroy_pooled_node(n);
+            }
         };
 
         node* head;
         node* tail;
         std::atomic<size_t> size;
+        node_pool<node, Alloc>* pool;
+        size_t prefetch_distance;
         mutable std::mutex l_mutex;
 
         void clear();
+        node* make_node(const T& value, node_pool<node, Alloc>* from);
+        node_pool<node, Alloc>* retain_pool();
+        void push_back_unlocked(const T& value);
+        void push_front_unlocked(const T& value);
+        void pop_back_unlocked();
+        void pop_front_unlocked();
 
     public:
         singly_linked_list();
-        singly_linked_list(const singly_linked_list<T>& l);
-        singly_linked_list(singly_linked_list<T>&& l);
+        singly_linked_list(const singly_linked_list<T, Alloc>& l);
+        singly_linked_list(singly_linked_list<T, Alloc>&& l);
         ~singly_linked_list();
 
-        singly_linked_list& operator=(const singly_linked_list<T>& l) noexcept;
-        singly_linked_list& operator=(singly_linked_list<T>&& l) noexcept;
+        singly_linked_list& operator=(const singly_linked_list<T, Alloc>& l) noexcept;
+        singly_linked_list& operator=(singly_linked_list<T, Alloc>&& l) noexcept;
 
-        singly_linked_list<T> push_back(const T& value);
+        singly_linked_list<T, Alloc>& push_back(const T& value);
         void pop_back();
-        singly_linked_list<T> push_front(const T& value);
+        singly_linked_list<T, Alloc>& push_front(const T& value);
         void pop_front();
 
+        template<typename InputIt>
+        singly_linked_list<T, Alloc>& push_back_n(InputIt first, size_t n);
+        template<typename OutputIt>
+        size_t pop_front_n(OutputIt out, size_t n);
+        size_t pop_front_n(size_t n);
+
+        class batch;
+        batch lock_batch();
+
         const T& search(const T& value) const;
         size_t get_size() const;
 
+        void set_locality(bool enabled);
+        void set_prefetch_distance(size_t distance);
+        void compact();
+
+        void write_to(std::ostream& os) const;
+        size_t read_from(std::istream& is);
+
         class iterator;
         class const_iterator;
 
         iterator begin();
         iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
 };
         
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "mpmc_ring_buffer.hpp"
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/*
+    @file mpmc_ring_buffer.cpp
+    @brief The current cpp source file contains the actual implementation of the mpmc_ring_buffer class methods
+*/
+
+/**
+ * @brief Builds a buffer holding at least min_capacity elements, rounded up to a power of two.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename T>
+mpmc_ring_buffer<T>::mpmc_ring_buffer(size_t min_capacity) : enqueue_pos(0), dequeue_pos(0){
+    size_t capacity = 2;
+    while(capacity < min_capacity) capacity *= 2;
+
+    cells = alloc.allocate(capacity);
+    for(size_t i = 0; i < capacity; ++i){
+        new (&cells[i].sequence) std::atomic<size_t>(i);
+        new (&cells[i].value) T();
+    }
+    mask = capacity - 1;
+};
+
+/**
+ * @brief Destructor. No thread may use the buffer anymore.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename T>
+mpmc_ring_buffer<T>::~mpmc_ring_buffer(){
+    for(size_t i = 0; i <= mask; ++i) cells[i].value.~T();
+    alloc.deallocate(cells, mask + 1);
+};
+
+/**
+ * @brief Appends el if the buffer is not full. Any thread.
+ *
+ * @return False if the buffer is full.
+ * 
+ * @note the time complexity is O(1) without contention, lock-free
+ */
+template<typename T>
+bool mpmc_ring_buffer<T>::try_push(const T& el){
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    cell* target;
+
+    while(true){
+        target = &cells[pos & mask];
+        const intptr_t lap = static_cast<intptr_t>(target->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos);
+
+        if(lap == 0){
+            if(enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if(lap < 0) return false;
+        else pos = enqueue_pos.load(std::memory_order_relaxed);
+    }
+
+    target->value = el;
+    target->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+};
+
+/**
+ * @brief Removes the oldest element into out if the buffer is not empty. Any thread.
+ *
+ * @return False if the buffer is empty.
+ * 
+ * @note the time complexity is O(1) without contention, lock-free
+ */
+template<typename T>
+bool mpmc_ring_buffer<T>::try_pop(T& out){
+    size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    cell* target;
+
+    while(true){
+        target = &cells[pos & mask];
+        const intptr_t lap = static_cast<intptr_t>(target->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos + 1);
+
+        if(lap == 0){
+            if(dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if(lap < 0) return false;
+        else pos = dequeue_pos.load(std::memory_order_relaxed);
+    }
+
+    out = std::move(target->value);
+    target->sequence.store(pos + mask + 1, std::memory_order_release);
+
+    return true;
+};
+
+/**
+ * @brief Appends items in order until n are appended or the buffer is full. Other producers may interleave.
+ *
+ * @return The number of items appended.
+ * 
+ * @note the time complexity is O(n), lock-free
+ */
+template<typename T>
+size_t mpmc_ring_buffer<T>::push_n(const T* items, size_t n){
+    size_t pushed = 0;
+    while(pushed < n && try_push(items[pushed])) ++pushed;
+    return pushed;
+};
+
+/**
+ * @brief Removes elements in order until n are removed or the buffer is empty. Other consumers may interleave.
+ *
+ * @return The number of elements removed.
+ * 
+ * @note the time complexity is O(n), lock-free
+ */
+template<typename T>
+size_t mpmc_ring_buffer<T>::pop_n(T* out, size_t n){
+    size_t popped = 0;
+    while(popped < n && try_pop(out[popped])) ++popped;
+    return popped;
+};
+
+/**
+ * @brief Returns an approximation of the number of stored elements while other threads operate on the buffer.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t mpmc_ring_buffer<T>::get_size() const{
+    const size_t head = dequeue_pos.load(std::memory_order_acquire);
+    const size_t tail = enqueue_pos.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+};
+
+/**
+ * @brief Returns the number of slots.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t mpmc_ring_buffer<T>::get_capacity() const{
+    return mask + 1;
+};
+
+/**
+ * @brief Checks if the buffer looks empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool mpmc_ring_buffer<T>::empty() const{
+    return get_size() == 0;
+};
@@ -0,0 +1,50 @@
+#ifndef MPMC_RING_BUFFER_HPP
+#define MPMC_RING_BUFFER_HPP
+#include <atomic>
+#include <cstddef>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file mpmc_ring_buffer.hpp
+ * @brief Bounded, lock-free multi-producer multi-consumer ring buffer.
+ *
+ * Every slot carries a sequence number telling which lap of the ring it is ready for: a producer may fill the slot
+ * at position p when its sequence equals p, and a consumer may empty it when its sequence equals p + 1. Producers
+ * and consumers claim positions with a CAS on their own index, so they only contend with threads of the same kind,
+ * and the two indices live on separate cache lines. The slot array is allocated once through allocator and the
+ * buffer never allocates or locks afterwards.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class mpmc_ring_buffer{
+    struct cell{
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    cell* cells;
+    size_t mask;
+    allocator<cell> alloc;
+    alignas(64) std::atomic<size_t> enqueue_pos;
+    alignas(64) std::atomic<size_t> dequeue_pos;
+
+    public:
+        explicit mpmc_ring_buffer(size_t min_capacity);
+        mpmc_ring_buffer(const mpmc_ring_buffer<T>& rb) = delete;
+        ~mpmc_ring_buffer();
+
+        mpmc_ring_buffer<T>& operator=(const mpmc_ring_buffer<T>& rb) = delete;
+
+        bool try_push(const T& el);
+        bool try_pop(T& out);
+        size_t push_n(const T* items, size_t n);
+        size_t pop_n(T* out, size_t n);
+
+        size_t get_size() const;
+        size_t get_capacity() const;
+        bool empty() const;
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "spsc_ring_buffer.hpp"
+#include <new>
+#include <utility>
+
+/*
+    @file spsc_ring_buffer.cpp
+    @brief The current cpp source file contains the actual implementation of the spsc_ring_buffer class methods
+*/
+
+/**
+ * @brief Builds a buffer holding at least min_capacity elements, rounded up to a power of two.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename T>
+spsc_ring_buffer<T>::spsc_ring_buffer(size_t min_capacity){
+    size_t capacity = 2;
+    while(capacity < min_capacity) capacity *= 2;
+
+    slots = alloc.allocate(capacity);
+    for(size_t i = 0; i < capacity; ++i) new (&slots[i]) T();
+    mask = capacity - 1;
+};
+
+/**
+ * @brief Destructor. Neither the producer nor the consumer may use the buffer anymore.
+ * 
+ * @note the time complexity is O(capacity)
+ */
+template<typename T>
+spsc_ring_buffer<T>::~spsc_ring_buffer(){
+    for(size_t i = 0; i <= mask; ++i) slots[i].~T();
+    alloc.deallocate(slots, mask + 1);
+};
+
+/**
+ * @brief Appends el if the buffer is not full. Producer thread only.
+ *
+ * @return False if the buffer is full.
+ * 
+ * @note the time complexity is O(1), wait-free
+ */
+template<typename T>
+bool spsc_ring_buffer<T>::try_push(const T& el){
+    const size_t tail = producer.tail.load(std::memory_order_relaxed);
+
+    if(tail - producer.cached_head > mask){
+        producer.cached_head = consumer.head.load(std::memory_order_acquire);
+        if(tail - producer.cached_head > mask) return false;
+    }
+
+    slots[tail & mask] = el;
+    producer.tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+};
+
+/**
+ * @brief Removes the oldest element into out if the buffer is not empty. Consumer thread only.
+ *
+ * @return False if the buffer is empty.
+ * 
+ * @note the time complexity is O(1), wait-free
+ */
+template<typename T>
+bool spsc_ring_buffer<T>::try_pop(T& out){
+    const size_t head = consumer.head.load(std::memory_order_relaxed);
+
+    if(head == consumer.cached_tail){
+        consumer.cached_tail = producer.tail.load(std::memory_order_acquire);
+        if(head == consumer.cached_tail) return false;
+    }
+
+    out = std::move(slots[head & mask]);
+    consumer.head.store(head + 1, std::memory_order_release);
+
+    return true;
+};
+
+/**
+ * @brief Appends as many of the n items as fit, publishing them with a single index update. Producer thread only.
+ *
+ * @return The number of items appended.
+ * 
+ * @note the time complexity is O(n), wait-free
+ */
+template<typename T>
+size_t spsc_ring_buffer<T>::push_n(const T* items, size_t n){
+    const size_t tail = producer.tail.load(std::memory_order_relaxed);
+
+    size_t free_slots = mask + 1 - (tail - producer.cached_head);
+    if(free_slots < n){
+        producer.cached_head = consumer.head.load(std::memory_order_acquire);
+        free_slots = mask + 1 - (tail - producer.cached_head);
+    }
+    if(n > free_slots) n = free_slots;
+
+    for(size_t i = 0; i < n; ++i) slots[(tail + i) & mask] = items[i];
+    producer.tail.store(tail + n, std::memory_order_release);
+
+    return n;
+};
+
+/**
+ * @brief Removes up to n of the oldest elements into out, releasing their slots with a single index update.
+ * Consumer thread only.
+ *
+ * @return The number of elements removed.
+ * 
+ * @note the time complexity is O(n), wait-free
+ */
+template<typename T>
+size_t spsc_ring_buffer<T>::pop_n(T* out, size_t n){
+    const size_t head = consumer.head.load(std::memory_order_relaxed);
+
+    size_t available = consumer.cached_tail - head;
+    if(available < n){
+        consumer.cached_tail = producer.tail.load(std::memory_order_acquire);
+        available = consumer.cached_tail - head;
+    }
+    if(n > available) n = available;
+
+    for(size_t i = 0; i < n; ++i) out[i] = std::move(slots[(head + i) & mask]);
+    consumer.head.store(head + n, std::memory_order_release);
+
+    return n;
+};
+
+/**
+ * @brief Returns the number of stored elements. Exact only when called by the producer or the consumer while
+ * the other side is idle.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t spsc_ring_buffer<T>::get_size() const{
+    const size_t head = consumer.head.load(std::memory_order_acquire);
+    const size_t tail = producer.tail.load(std::memory_order_acquire);
+    return tail - head;
+};
+
+/**
+ * @brief Returns the number of slots.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t spsc_ring_buffer<T>::get_capacity() const{
+    return mask + 1;
+};
+
+/**
+ * @brief Checks if the buffer is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool spsc_ring_buffer<T>::empty() const{
+    return get_size() == 0;
+};
@@ -0,0 +1,55 @@
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+#include <atomic>
+#include <cstddef>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file spsc_ring_buffer.hpp
+ * @brief Bounded, wait-free single-producer single-consumer ring buffer.
+ *
+ * The slot array, exactly capacity slots, is allocated once through allocator when the buffer is built; pushing
+ * and popping never allocate or lock. Exactly one thread may push and exactly one thread may pop at the same
+ * time. Every operation completes in a bounded number of steps: the producer only writes the tail index and the
+ * consumer only writes the head index, each on its own cache line together with a cached copy of the other
+ * index, so the indices bounce between cores only when the cached copy says the buffer looks full (or empty).
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class spsc_ring_buffer{
+    struct alignas(64) producer_side{
+        std::atomic<size_t> tail{0};
+        size_t cached_head = 0;
+    };
+
+    struct alignas(64) consumer_side{
+        std::atomic<size_t> head{0};
+        size_t cached_tail = 0;
+    };
+
+    T* slots;
+    size_t mask;
+    allocator<T> alloc;
+    producer_side producer;
+    consumer_side consumer;
+
+    public:
+        explicit spsc_ring_buffer(size_t min_capacity);
+        spsc_ring_buffer(const spsc_ring_buffer<T>& rb) = delete;
+        ~spsc_ring_buffer();
+
+        spsc_ring_buffer<T>& operator=(const spsc_ring_buffer<T>& rb) = delete;
+
+        bool try_push(const T& el);
+        bool try_pop(T& out);
+        size_t push_n(const T* items, size_t n);
+        size_t pop_n(T* out, size_t n);
+
+        size_t get_size() const;
+        size_t get_capacity() const;
+        bool empty() const;
+};
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef TASK_SCHEDULER_CPP
+#define TASK_SCHEDULER_CPP
+#include "task_scheduler.hpp"
+
+/*
+    @file task_scheduler.cpp
+    @brief The current cpp source file contains the actual implementation of the task_scheduler class methods.
+    The definitions are inline since the file is included wherever task_scheduler is used.
+*/
+
+/**
+ * @brief Constructor that starts the workers.
+ *
+ * @param worker_count The number of worker threads, 0 meaning one per hardware thread.
+ *
+ * @note the time complexity is O(worker_count)
+ */
+inline task_scheduler::task_scheduler(size_t worker_count) : queued(0), sleeping(0), stopping(false){
+    if(worker_count == 0) worker_count = std::thread::hardware_concurrency();
+    if(worker_count == 0) worker_count = 1;
+
+    for(size_t i = 0; i < worker_count; ++i) workers.emplace_back(new worker());
+    for(size_t i = 0; i < worker_count; ++i) workers[i]->thread = std::thread(&task_scheduler::worker_loop, this, i);
+};
+
+/**
+ * @brief Destructor that lets the workers finish every queued task, then joins them.
+ *
+ * @note the time complexity is O(worker_count), plus the queued tasks
+ */
+inline task_scheduler::~task_scheduler(){
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        wake.notify_all();
+    }
+    for(std::unique_ptr<worker>& w : workers) w->thread.join();
+};
+
+/**
+ * @brief Runs f on some worker, without a way to wait for it. f must not throw.
+ *
+ * @param f The callable to run.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename F>
+inline void task_scheduler::submit(F&& f){
+    enqueue(new task{std::function<void()>(std::forward<F>(f)), nullptr});
+};
+
+/**
+ * @brief Executes one pending task on the calling thread, if any can be found.
+ *
+ * @return True if a task was executed.
+ *
+ * @note the time complexity is O(worker_count) to find the task, plus the task itself
+ */
+inline bool task_scheduler::run_one(){
+    task* t = find_task(current_worker());
+    if(!t) return false;
+
+    execute(t);
+    return true;
+};
+
+/**
+ * @brief Calls f(i) for every i in [first, last), in parallel, and returns when all the calls are done.
+ *
+ * The range is split in halves recursively: the calling task keeps the left half and spawns the right one, until
+ * the pieces have at most grain indices, so idle workers steal large pieces first.
+ *
+ * @param first The first index.
+ * @param last The index past the last one.
+ * @param f The callable, invoked concurrently from several threads.
+ * @param grain The largest piece run sequentially, 0 choosing about eight pieces per worker.
+ * @throws Rethrows the first exception thrown by f.
+ *
+ * @note the time complexity is O((last - first) / workers + log(last - first)) with enough parallelism
+ */
+template<typename F>
+inline void task_scheduler::parallel_for(size_t first, size_t last, F f, size_t grain){
+    if(first >= last) return;
+    if(grain == 0) grain = (last - first) / (workers.size() * 8);
+    if(grain == 0) grain = 1;
+
+    task_group group(*this);
+    std::function<void(size_t, size_t)> split = [&](size_t lo, size_t hi){
+        while(hi - lo > grain){
+            const size_t mid = lo + (hi - lo) / 2;
+            group.run([&split, mid, hi]{ split(mid, hi); });
+            hi = mid;
+        }
+        for(size_t i = lo; i < hi; ++i) f(i);
+    };
+
+    //an exception on the calling thread is handed to the group instead of unwinding past it: the tasks already
+    //spawned still call split, so split must outlive them
+    try{
+        split(first, last);
+    }
+    catch(...){
+        group.fail(std::current_exception());
+    }
+    group.wait();
+};
+
+/**
+ * @brief Calls f(el) for every element of v, in parallel.
+ *
+ * The elements are accessed directly in the vector storage, not through the locking accessors, so v must not be
+ * resized meanwhile.
+ *
+ * @param v The vector.
+ * @param f The callable taking a T&, invoked concurrently from several threads.
+ * @param grain The largest number of elements processed sequentially, 0 choosing automatically.
+ *
+ * @note the time complexity is O(size / workers + log(size)) with enough parallelism
+ */
+template<typename T, typename Alloc, typename F>
+inline void task_scheduler::parallel_for(vector<T, Alloc>& v, F f, size_t grain){
+    if(v.empty()) return;
+
+    T* data = &*v.begin();
+    parallel_for(0, v.get_size(), [data, &f](size_t i){ f(data[i]); }, grain);
+};
+
+/**
+ * @brief Returns the number of worker threads.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t task_scheduler::get_workers() const{
+    return workers.size();
+};
+
+/**
+ * @brief Returns the index of the calling thread among the workers, or npos for an outside thread.
+ */
+inline size_t task_scheduler::current_worker() const{
+    return context.owner == this ? context.index : npos;
+};
+
+/**
+ * @brief Queues a task: on the own deque of a worker, in the injection deque otherwise, then wakes a sleeper.
+ */
+inline void task_scheduler::enqueue(task* t){
+    //counted before being visible, so that a taker never decrements below zero
+    queued.fetch_add(1);
+
+    const size_t self = current_worker();
+    if(self != npos) workers[self]->tasks.push(t);
+    else injected.push_back(t);
+
+    if(sleeping.load() > 0){
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        wake.notify_one();
+    }
+};
+
+/**
+ * @brief Takes a task from the own deque, then from the injection deque, then from random victims.
+ *
+ * @param self The index of the calling worker, npos for an outside thread.
+ * @return The task, or nullptr if none was found.
+ */
+inline task_scheduler::task* task_scheduler::find_task(size_t self){
+    task* t = nullptr;
+
+    if(self != npos && workers[self]->tasks.pop(t)){
+        queued.fetch_sub(1);
+        return t;
+    }
+
+    {
+        deque<task*>::batch b = injected.lock_batch();
+        if(!b.empty()){
+            t = b[0];
+            b.pop_front();
+            queued.fetch_sub(1);
+            return t;
+        }
+    }
+
+    static thread_local uint64_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    const size_t n = workers.size();
+
+    for(size_t attempt = 0; attempt < 2 * n; ++attempt){
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        const size_t victim = seed % n;
+        if(victim != self && workers[victim]->tasks.steal(t)){
+            queued.fetch_sub(1);
+            return t;
+        }
+    }
+
+    return nullptr;
+};
+
+/**
+ * @brief Runs a task, records its exception in its group, and signals the group once done.
+ */
+inline void task_scheduler::execute(task* t){
+    task_group* group = t->group;
+
+    if(group){
+        try{
+            t->fn();
+        }
+        catch(...){
+            group->fail(std::current_exception());
+        }
+        delete t;
+        //the group may be destroyed as soon as pending reaches zero
+        group->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    else{
+        t->fn();
+        delete t;
+    }
+};
+
+/**
+ * @brief Body of worker index: runs tasks while it finds any, spins a little, then sleeps until new work arrives.
+ */
+inline void task_scheduler::worker_loop(size_t index){
+    context = worker_context{this, index};
+
+    while(true){
+        task* t = find_task(index);
+        for(int spin = 0; !t && spin < 64; ++spin){
+            std::this_thread::yield();
+            t = find_task(index);
+        }
+
+        if(t){
+            execute(t);
+            continue;
+        }
+        if(stopping.load() && queued.load() == 0) break;
+
+        sleeping.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            wake.wait(lock, [this]{ return queued.load() > 0 || stopping.load(); });
+        }
+        sleeping.fetch_sub(1);
+    }
+
+    context = worker_context{nullptr, npos};
+};
+
+/**
+ * @brief Constructor that creates an empty group running its tasks on s.
+ *
+ * @note the time complexity is O(1)
+ */
+inline task_scheduler::task_group::task_group(task_scheduler& s) : owner(&s), pending(0){};
+
+/**
+ * @brief Destructor that waits for the tasks still running, discarding their exceptions.
+ */
+inline task_scheduler::task_group::~task_group(){
+    while(pending.load(std::memory_order_acquire) > 0){
+        if(!owner->run_one()) std::this_thread::yield();
+    }
+};
+
+/**
+ * @brief Runs f as part of the group.
+ *
+ * @param f The callable to run.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename F>
+inline void task_scheduler::task_group::run(F&& f){
+    pending.fetch_add(1, std::memory_order_relaxed);
+    owner->enqueue(new task{std::function<void()>(std::forward<F>(f)), this});
+};
+
+/**
+ * @brief Returns once every task of the group is done, executing pending tasks meanwhile.
+ *
+ * @throws Rethrows the first exception thrown by a task of the group.
+ */
+inline void task_scheduler::task_group::wait(){
+    while(pending.load(std::memory_order_acquire) > 0){
+        if(!owner->run_one()) std::this_thread::yield();
+    }
+
+    std::lock_guard<std::mutex> lock(error_mutex);
+    if(error){
+        std::exception_ptr e = error;
+        error = nullptr;
+        std::rethrow_exception(e);
+    }
+};
+
+inline void task_scheduler::task_group::fail(std::exception_ptr e){
+    std::lock_guard<std::mutex> lock(error_mutex);
+    if(!error) error = e;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef TASK_SCHEDULER_HPP
+#define TASK_SCHEDULER_HPP
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../deque/deque.cpp"
+#include "../deque/work_stealing_deque.cpp"
+#include "../vector/vector.cpp"
+
+/**
+ * @file task_scheduler.hpp
+ * @brief Work-stealing thread pool with fork/join task groups and parallel_for.
+ *
+ * Every worker owns a work_stealing_deque: tasks spawned by a worker go to the bottom of its own deque and are
+ * popped back in LIFO order, which keeps the working set in cache, while idle workers steal the oldest tasks from
+ * the top of a random victim. Workers thus contend only when stealing, instead of all serializing on the mutex of
+ * a shared queue. Tasks submitted from outside the pool go through a shared injection deque. Idle workers spin
+ * briefly, then sleep until new tasks arrive.
+ *
+ * A task_group tracks the tasks it runs; its wait() executes pending tasks instead of blocking, so nested
+ * fork/join (e.g. recursive algorithms spawning subtasks from within tasks) never deadlocks the pool.
+ *
+ * @author Andrea Maggetto
+ */
+
+class task_scheduler{
+    public:
+        class task_group;
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        struct task{
+            std::function<void()> fn;
+            task_group* group;
+        };
+
+        struct worker{
+            work_stealing_deque<task*> tasks;
+            std::thread thread;
+        };
+
+        struct worker_context{
+            const task_scheduler* owner;
+            size_t index;
+        };
+
+        static inline thread_local worker_context context{nullptr, npos};
+
+        std::vector<std::unique_ptr<worker>> workers;
+        deque<task*> injected;
+        std::atomic<size_t> queued;
+        std::atomic<size_t> sleeping;
+        std::atomic<bool> stopping;
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+
+        size_t current_worker() const;
+        void enqueue(task* t);
+        task* find_task(size_t self);
+        void execute(task* t);
+        void worker_loop(size_t index);
+
+    public:
+        explicit task_scheduler(size_t worker_count = 0);
+        task_scheduler(const task_scheduler& s) = delete;
+        task_scheduler& operator=(const task_scheduler& s) = delete;
+        ~task_scheduler();
+
+        template<typename F>
+        void submit(F&& f);
+        bool run_one();
+
+        template<typename F>
+        void parallel_for(size_t first, size_t last, F f, size_t grain = 0);
+        template<typename T, typename Alloc, typename F>
+        void parallel_for(vector<T, Alloc>& v, F f, size_t grain = 0);
+
+        size_t get_workers() const;
+};
+
+/**
+ * @class task_group
+ * @brief Set of tasks that can be waited for together.
+ */
+class task_scheduler::task_group{
+    task_scheduler* owner;
+    std::atomic<size_t> pending;
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    friend class task_scheduler;
+
+    void fail(std::exception_ptr e);
+
+    public:
+        explicit task_group(task_scheduler& s);
+        task_group(const task_group& g) = delete;
+        task_group& operator=(const task_group& g) = delete;
+        ~task_group();
+
+        template<typename F>
+        void run(F&& f);
+        void wait();
+};
+
+#endif
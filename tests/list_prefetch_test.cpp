@@ -0,0 +1,82 @@
+#include <cassert>
+#include "../list/singly_linked_list/singly_linked_list.cpp"
+#include "../list/doubly_linked_list/doubly_linked_list.cpp"
+
+/*
+    @file list_prefetch_test.cpp
+    @brief Standalone checks that prefetching iterators of the lists stay usable when the nodes ahead of them are
+    erased, spliced away or freed. Build without NDEBUG, with AddressSanitizer to catch reads of freed nodes:
+
+        g++ -std=c++20 -g -fsanitize=address,undefined -pthread tests/list_prefetch_test.cpp -o list_prefetch_test
+*/
+
+/**
+ * @brief Advances it n times.
+ */
+template<typename It>
+It advance(It it, size_t n){
+    for(size_t i = 0; i < n; ++i) ++it;
+    return it;
+}
+
+int main(){
+    const size_t distance = 3;
+
+    //doubly_linked_list: erase the node distance places ahead of a live iterator, then advance it
+    for(const bool locality : {false, true}){
+        doubly_linked_list<int> l;
+        l.set_locality(locality);
+        l.set_prefetch_distance(distance);
+        for(int i = 0; i < 10; ++i) l.push_back(i);
+
+        doubly_linked_list<int>::iterator it = advance(l.begin(), 1);
+        l.erase(advance(l.begin(), 1 + distance));
+        l.erase(advance(l.begin(), 1 + distance));
+        int expected[] = {1, 2, 3, 6, 7, 8, 9};
+        for(int e : expected){
+            assert(*it == e);
+            ++it;
+        }
+        assert(it == l.end());
+    }
+
+    //doubly_linked_list: splice the nodes ahead into another list that is then destroyed
+    {
+        doubly_linked_list<int> l;
+        l.set_prefetch_distance(distance);
+        for(int i = 0; i < 10; ++i) l.push_back(i);
+
+        const doubly_linked_list<int>& cl = l;
+        doubly_linked_list<int>::const_iterator it = cl.begin();
+        {
+            doubly_linked_list<int> other;
+            other.splice(other.end(), l, advance(l.begin(), 2), l.end());
+        }
+        assert(*it == 0);
+        ++it;
+        assert(*it == 1);
+        ++it;
+        assert(it == cl.end());
+    }
+
+    //singly_linked_list: free the tail while it is the node distance places ahead of a live iterator
+    for(const bool locality : {false, true}){
+        singly_linked_list<int> l;
+        l.set_locality(locality);
+        l.set_prefetch_distance(distance);
+        for(int i = 0; i <= (int)distance; ++i) l.push_back(i);
+
+        singly_linked_list<int>::iterator it = l.begin();
+        const singly_linked_list<int>& cl = l;
+        singly_linked_list<int>::const_iterator cit = cl.begin();
+        l.pop_back();
+        for(int e = 0; e < (int)distance; ++e){
+            assert(*it == e && *cit == e);
+            ++it;
+            ++cit;
+        }
+        assert(it == l.end() && cit == cl.end());
+    }
+
+    return 0;
+}
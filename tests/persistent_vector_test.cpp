@@ -0,0 +1,137 @@
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../vector/persistent_vector.cpp"
+
+/*
+    @file persistent_vector_test.cpp
+    @brief Standalone crash-consistency checks of persistent_vector: a forked child modifies the vector and dies
+    with _exit, skipping the destructor's sync, then the parent reopens the file. Build without NDEBUG:
+
+        g++ -std=c++20 -g -fsanitize=address,undefined -pthread tests/persistent_vector_test.cpp -o persistent_vector_test
+*/
+
+/**
+ * @brief Creates an empty temporary file and returns its path.
+ */
+std::string temp_path(){
+    char path[] = "/tmp/persistent_vector_test_XXXXXX";
+    const int fd = ::mkstemp(path);
+    assert(fd >= 0);
+    ::close(fd);
+    return path;
+}
+
+/**
+ * @brief Writes 0 .. n-1 to a fresh file at path and syncs it.
+ */
+void create_synced(const std::string& path, long long n){
+    persistent_vector<long long> v(path);
+    v.clear();
+    for(long long i = 0; i < n; ++i) v.push_back(i);
+    v.sync();
+}
+
+/**
+ * @brief Runs crash on the vector stored in path in a child process that then exits without syncing.
+ */
+template<typename F>
+void crash_after(const std::string& path, F crash){
+    const pid_t pid = ::fork();
+    assert(pid >= 0);
+    if(pid == 0){
+        persistent_vector<long long> v(path);
+        crash(v);
+        ::_exit(0);
+    }
+    int status = 0;
+    assert(::waitpid(pid, &status, 0) == pid);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+int main(){
+    const std::string path = temp_path();
+
+    //appends past the committed count are dropped, even across a growth of the file
+    create_synced(path, 10);
+    crash_after(path, [](persistent_vector<long long>& v){
+        for(long long i = 10; i < 100; ++i) v.push_back(i);
+    });
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 10);
+        for(long long i = 0; i < 10; ++i) assert(v[i] == i);
+    }
+
+    //a completed sync commits the appends made before it, not those made after it
+    create_synced(path, 10);
+    crash_after(path, [](persistent_vector<long long>& v){
+        for(long long i = 10; i < 15; ++i) v.push_back(i);
+        v.sync();
+        for(long long i = 15; i < 20; ++i) v.push_back(i);
+    });
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 15);
+        for(long long i = 0; i < 15; ++i) assert(v[i] == i);
+    }
+
+    //pop_back and clear are not committed without a sync: the count is restored
+    create_synced(path, 10);
+    crash_after(path, [](persistent_vector<long long>& v){
+        v.pop_back();
+        v.pop_back();
+        v.clear();
+    });
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 10);
+        for(long long i = 0; i < 10; ++i) assert(v[i] == i);
+    }
+
+    //writes below the committed count go to the file in place: the count is restored, untouched elements keep
+    //their synced values, and each overwritten element holds either its synced or its unsynced value
+    create_synced(path, 10);
+    crash_after(path, [](persistent_vector<long long>& v){
+        v.clear();
+        for(long long i = 0; i < 5; ++i) v.push_back(100 + i);
+        v[9] = -1;
+    });
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 10);
+        for(long long i = 0; i < 5; ++i) assert(v[i] == i || v[i] == 100 + i);
+        for(long long i = 5; i < 9; ++i) assert(v[i] == i);
+        assert(v[9] == 9 || v[9] == -1);
+    }
+
+    //the same changes followed by a sync are committed as a whole
+    create_synced(path, 10);
+    crash_after(path, [](persistent_vector<long long>& v){
+        v.clear();
+        for(long long i = 0; i < 5; ++i) v.push_back(100 + i);
+        v.sync();
+        v.push_back(-1);
+    });
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 5);
+        for(long long i = 0; i < 5; ++i) assert(v[i] == 100 + i);
+    }
+
+    //a clean close syncs through the destructor
+    {
+        persistent_vector<long long> v(path);
+        v.push_back(7);
+    }
+    {
+        persistent_vector<long long> v(path);
+        assert(v.get_size() == 6 && v.back() == 7);
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include "../scheduler/task_scheduler.cpp"
+
+/*
+    @file task_scheduler_test.cpp
+    @brief Standalone checks of task_scheduler::parallel_for and task_group, including exceptions thrown by the
+    callable on the calling thread and on the workers. Build without NDEBUG, ideally with sanitizers:
+
+        g++ -std=c++20 -g -fsanitize=address,undefined -pthread tests/task_scheduler_test.cpp -o task_scheduler_test
+*/
+
+/**
+ * @brief Runs a parallel_for whose callable throws at index bad and checks that the exception reaches the caller
+ * only after every piece has finished.
+ */
+void throwing_parallel_for(task_scheduler& s, size_t n, size_t bad){
+    std::atomic<size_t> calls{0};
+    bool thrown = false;
+    try{
+        s.parallel_for(0, n, [&](size_t i){
+            calls.fetch_add(1);
+            if(i == bad) throw std::runtime_error("bad index");
+        }, 16);
+    }
+    catch(const std::runtime_error&){
+        thrown = true;
+    }
+    assert(thrown);
+    assert(calls.load() >= 1 && calls.load() <= n);
+}
+
+int main(){
+    task_scheduler s(4);
+
+    std::atomic<long long> sum{0};
+    s.parallel_for(0, 100000, [&](size_t i){ sum.fetch_add((long long)i); });
+    assert(sum.load() == 100000LL * 99999 / 2);
+
+    //index 0 runs on the calling thread, the last index on a task
+    throwing_parallel_for(s, 10000, 0);
+    throwing_parallel_for(s, 10000, 9999);
+    throwing_parallel_for(s, 10000, 5000);
+
+    //the scheduler is still usable after the failures
+    vector<int> v(1, 1000);
+    s.parallel_for(v, [](int& el){ el *= 2; });
+    for(size_t i = 0; i < v.get_size(); ++i) assert(v[i] == 2);
+
+    task_scheduler::task_group g(s);
+    std::atomic<int> done{0};
+    for(int i = 0; i < 100; ++i) g.run([&]{ done.fetch_add(1); });
+    g.wait();
+    assert(done.load() == 100);
+
+    g.run([]{ throw std::logic_error("task failure"); });
+    bool thrown = false;
+    try{
+        g.wait();
+    }
+    catch(const std::logic_error&){
+        thrown = true;
+    }
+    assert(thrown);
+
+    return 0;
+}
@@ -0,0 +1,575 @@
+#ifndef BIT_VECTOR_CPP
+#define BIT_VECTOR_CPP
+#include "bit_vector.hpp"
+#include <bit>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+    @file bit_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the bit_vector class methods.
+    The definitions are inline since the file is included wherever bit_vector is used.
+*/
+
+/**
+ * @brief Proxy standing for one bit of a non-const bit_vector. Like operator[], it does not check bounds.
+ */
+class bit_vector::reference{
+    public:
+        reference(bit_vector& b, size_t i) : owner(&b), index(i){};
+
+        operator bool() const{
+            return owner->read_bit(index);
+        }
+        reference& operator=(bool value){
+            owner->write_bit(index, value);
+            return *this;
+        }
+        reference& operator=(const reference& r){
+            owner->write_bit(index, static_cast<bool>(r));
+            return *this;
+        }
+
+    private:
+        bit_vector* owner;
+        size_t index;
+};
+
+/**
+ * @brief Word-wise operations combined by apply, in their vector and scalar forms.
+ */
+struct bit_vector::bit_and{
+#ifdef __AVX2__
+    static __m256i on(__m256i a, __m256i b){ return _mm256_and_si256(a, b); }
+#endif
+#ifdef __SSE2__
+    static __m128i on(__m128i a, __m128i b){ return _mm_and_si128(a, b); }
+#endif
+    static uint64_t on(uint64_t a, uint64_t b){ return a & b; }
+};
+
+struct bit_vector::bit_or{
+#ifdef __AVX2__
+    static __m256i on(__m256i a, __m256i b){ return _mm256_or_si256(a, b); }
+#endif
+#ifdef __SSE2__
+    static __m128i on(__m128i a, __m128i b){ return _mm_or_si128(a, b); }
+#endif
+    static uint64_t on(uint64_t a, uint64_t b){ return a | b; }
+};
+
+struct bit_vector::bit_xor{
+#ifdef __AVX2__
+    static __m256i on(__m256i a, __m256i b){ return _mm256_xor_si256(a, b); }
+#endif
+#ifdef __SSE2__
+    static __m128i on(__m128i a, __m128i b){ return _mm_xor_si128(a, b); }
+#endif
+    static uint64_t on(uint64_t a, uint64_t b){ return a ^ b; }
+};
+
+/**
+ * @brief Default constructor that initializes an empty bit vector.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bit_vector::bit_vector() : words(nullptr), size(0), capacity(0){};
+
+/**
+ * @brief Constructor that initializes n bits to value.
+ *
+ * @param n The number of bits.
+ * @param value The initial value of every bit.
+ *
+ * @note the time complexity is O(n / 64)
+ */
+inline bit_vector::bit_vector(size_t n, bool value) : words(nullptr), size(0), capacity(0){
+    resize_unlocked(n, value);
+};
+
+/**
+ * @brief Copy constructor.
+ *
+ * @param b The bit vector to be copied.
+ *
+ * @note the time complexity is O(b.size / 64)
+ */
+inline bit_vector::bit_vector(const bit_vector& b) : words(nullptr), size(0), capacity(0){
+    std::lock_guard<std::mutex> lock(b.mtx_);
+    copy_from(b);
+};
+
+/**
+ * @brief Move constructor. The source is left empty.
+ *
+ * @param b The bit vector to be moved.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bit_vector::bit_vector(bit_vector&& b){
+    std::lock_guard<std::mutex> lock(b.mtx_);
+    words = b.words;
+    size = b.size;
+    capacity = b.capacity;
+    b.words = nullptr;
+    b.size = b.capacity = 0;
+};
+
+inline bit_vector::~bit_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param b The bit vector to be copied.
+ * @return Reference to the modified bit vector.
+ *
+ * @note the time complexity is O(b.size / 64)
+ */
+inline bit_vector& bit_vector::operator=(const bit_vector& b){
+    if(this != &b){
+        std::lock(mtx_, b.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(b.mtx_, std::adopt_lock);
+
+        clean_up();
+        copy_from(b);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source is left empty.
+ *
+ * @param b The bit vector to be moved.
+ * @return Reference to the modified bit vector.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bit_vector& bit_vector::operator=(bit_vector&& b) noexcept{
+    if(this != &b){
+        std::lock(mtx_, b.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(b.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        words = b.words;
+        size = b.size;
+        capacity = b.capacity;
+
+        b.words = nullptr;
+        b.size = b.capacity = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Reads a bit, without bounds checking.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bool bit_vector::operator[](const size_t index) const{
+    return read_bit(index);
+};
+
+/**
+ * @brief Returns a proxy to read or write a bit, without bounds checking.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bit_vector::reference bit_vector::operator[](const size_t index){
+    return reference(*this, index);
+};
+
+/**
+ * @brief Reads a bit under the lock, without bounds checking.
+ */
+inline bool bit_vector::read_bit(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return (words[index / word_bits] >> (index % word_bits)) & 1;
+};
+
+/**
+ * @brief Writes a bit under the lock, without bounds checking.
+ */
+inline void bit_vector::write_bit(const size_t index, bool value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    const uint64_t mask = uint64_t(1) << (index % word_bits);
+    if(value) words[index / word_bits] |= mask;
+    else words[index / word_bits] &= ~mask;
+};
+
+/**
+ * @brief Reads a bit with bounds checking.
+ *
+ * @param index The position of the bit.
+ * @return The value of the bit.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bool bit_vector::test(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return (words[index / word_bits] >> (index % word_bits)) & 1;
+};
+
+/**
+ * @brief Writes a bit with bounds checking.
+ *
+ * @param index The position of the bit.
+ * @param value The new value of the bit.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void bit_vector::set(const size_t index, bool value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+
+    const uint64_t mask = uint64_t(1) << (index % word_bits);
+    if(value) words[index / word_bits] |= mask;
+    else words[index / word_bits] &= ~mask;
+};
+
+/**
+ * @brief Clears a bit with bounds checking.
+ *
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void bit_vector::reset(const size_t index){
+    set(index, false);
+};
+
+/**
+ * @brief Inverts a bit with bounds checking.
+ *
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void bit_vector::flip(const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    words[index / word_bits] ^= uint64_t(1) << (index % word_bits);
+};
+
+/**
+ * @brief Sets every bit to value.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline void bit_vector::fill(bool value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    const size_t n = word_count();
+    for(size_t i = 0; i < n; ++i) words[i] = value ? ~uint64_t(0) : 0;
+    clear_tail();
+};
+
+/**
+ * @brief Appends a bit.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+inline void bit_vector::push_back(bool value){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    if(size % word_bits == 0){
+        if(size / word_bits == capacity) grow(capacity + 1);
+        words[size / word_bits] = 0;
+    }
+    words[size / word_bits] |= uint64_t(value) << (size % word_bits);
+    ++size;
+};
+
+/**
+ * @brief Removes the last bit.
+ *
+ * @throws std::out_of_range If the bit vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void bit_vector::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    --size;
+    clear_tail();
+};
+
+/**
+ * @brief Changes the number of bits; the added bits are set to value.
+ *
+ * @note the time complexity is O(new_size / 64)
+ */
+inline void bit_vector::resize(size_t new_size, bool value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    resize_unlocked(new_size, value);
+};
+
+/**
+ * @brief Removes every bit, keeping the storage.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void bit_vector::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    size = 0;
+};
+
+/**
+ * @brief Counts the set bits, one popcount per word.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline size_t bit_vector::count() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = word_count();
+    size_t total = 0;
+    for(size_t i = 0; i < n; ++i) total += std::popcount(words[i]);
+    return total;
+};
+
+/**
+ * @brief Returns the position of the first set bit, or npos if there is none.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline size_t bit_vector::find_first() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return find_from(0);
+};
+
+/**
+ * @brief Returns the position of the first set bit after position, or npos if there is none.
+ *
+ * @note the time complexity is O((size - position) / 64)
+ */
+inline size_t bit_vector::find_next(size_t position) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return position == npos ? npos : find_from(position + 1);
+};
+
+/**
+ * @brief Bitwise AND with another bit vector of the same size.
+ *
+ * @throws std::invalid_argument If the sizes differ.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline bit_vector& bit_vector::operator&=(const bit_vector& other){
+    return combine<bit_and>(other);
+};
+
+/**
+ * @brief Bitwise OR with another bit vector of the same size.
+ *
+ * @throws std::invalid_argument If the sizes differ.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline bit_vector& bit_vector::operator|=(const bit_vector& other){
+    return combine<bit_or>(other);
+};
+
+/**
+ * @brief Bitwise XOR with another bit vector of the same size.
+ *
+ * @throws std::invalid_argument If the sizes differ.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline bit_vector& bit_vector::operator^=(const bit_vector& other){
+    return combine<bit_xor>(other);
+};
+
+inline bit_vector bit_vector::operator&(const bit_vector& other) const{
+    bit_vector result(*this);
+    result &= other;
+    return result;
+};
+
+inline bit_vector bit_vector::operator|(const bit_vector& other) const{
+    bit_vector result(*this);
+    result |= other;
+    return result;
+};
+
+inline bit_vector bit_vector::operator^(const bit_vector& other) const{
+    bit_vector result(*this);
+    result ^= other;
+    return result;
+};
+
+/**
+ * @brief Equality comparison operator, word by word.
+ *
+ * @note the time complexity is O(size / 64)
+ */
+inline bool bit_vector::operator==(const bit_vector& other) const{
+    if(this == &other) return true;
+
+    std::lock(mtx_, other.mtx_);
+    std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(other.mtx_, std::adopt_lock);
+
+    if(size != other.size) return false;
+    const size_t n = word_count();
+    for(size_t i = 0; i < n; ++i){
+        if(words[i] != other.words[i]) return false;
+    }
+    return true;
+};
+
+inline bool bit_vector::operator!=(const bit_vector& other) const{
+    return !(*this == other);
+};
+
+/**
+ * @brief Returns the number of bits.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t bit_vector::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+inline bool bit_vector::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+inline size_t bit_vector::words_for(size_t bits){
+    return (bits + word_bits - 1) / word_bits;
+};
+
+/**
+ * @brief Computes dst[i] = Op(dst[i], src[i]) for n words, with the widest vector instructions available.
+ */
+template<typename Op>
+inline void bit_vector::apply(uint64_t* dst, const uint64_t* src, size_t n){
+    size_t i = 0;
+#ifdef __AVX2__
+    for(; i + 4 <= n; i += 4){
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::on(a, b));
+    }
+#endif
+#ifdef __SSE2__
+    for(; i + 2 <= n; i += 2){
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::on(a, b));
+    }
+#endif
+    for(; i < n; ++i) dst[i] = Op::on(dst[i], src[i]);
+};
+
+template<typename Op>
+inline bit_vector& bit_vector::combine(const bit_vector& other){
+    std::unique_lock<std::mutex> lock1(mtx_, std::defer_lock);
+    std::unique_lock<std::mutex> lock2;
+
+    if(this == &other) lock1.lock();
+    else{
+        lock2 = std::unique_lock<std::mutex>(other.mtx_, std::defer_lock);
+        std::lock(lock1, lock2);
+    }
+
+    if(size != other.size) throw std::invalid_argument("Bit vectors of different sizes");
+    apply<Op>(words, other.words, word_count());
+    return *this;
+};
+
+inline size_t bit_vector::word_count() const{
+    return words_for(size);
+};
+
+/**
+ * @brief Reallocates the storage to hold at least min_words words, doubling the capacity when that is larger.
+ * The caller must hold mtx_.
+ */
+inline void bit_vector::grow(size_t min_words){
+    size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
+    if(new_capacity < min_words) new_capacity = min_words;
+
+    uint64_t* new_words = alloc.allocate(new_capacity);
+    for(size_t i = 0; i < word_count(); ++i) new_words[i] = words[i];
+
+    if(words) alloc.deallocate(words, capacity);
+    words = new_words;
+    capacity = new_capacity;
+};
+
+/**
+ * @brief Changes the number of bits without locking. The caller must hold mtx_.
+ */
+inline void bit_vector::resize_unlocked(size_t new_size, bool value){
+    if(new_size <= size){
+        size = new_size;
+        clear_tail();
+        return;
+    }
+
+    const size_t old_size = size;
+    const size_t new_words = words_for(new_size);
+    if(new_words > capacity) grow(new_words);
+    for(size_t i = word_count(); i < new_words; ++i) words[i] = 0;
+    size = new_size;
+
+    if(value){
+        size_t i = old_size;
+        for(; i < new_size && i % word_bits != 0; ++i) words[i / word_bits] |= uint64_t(1) << (i % word_bits);
+        for(; i + word_bits <= new_size; i += word_bits) words[i / word_bits] = ~uint64_t(0);
+        for(; i < new_size; ++i) words[i / word_bits] |= uint64_t(1) << (i % word_bits);
+    }
+};
+
+/**
+ * @brief Zeroes the bits past size in the last word. The caller must hold mtx_.
+ */
+inline void bit_vector::clear_tail(){
+    if(size % word_bits != 0) words[size / word_bits] &= (uint64_t(1) << (size % word_bits)) - 1;
+};
+
+/**
+ * @brief Returns the first set bit at or after position, or npos. The caller must hold mtx_.
+ */
+inline size_t bit_vector::find_from(size_t position) const{
+    if(position >= size) return npos;
+
+    size_t w = position / word_bits;
+    uint64_t bits = words[w] & (~uint64_t(0) << (position % word_bits));
+    const size_t n = word_count();
+
+    while(true){
+        if(bits) return w * word_bits + std::countr_zero(bits);
+        if(++w == n) return npos;
+        bits = words[w];
+    }
+};
+
+inline void bit_vector::clean_up(){
+    if(words) alloc.deallocate(words, capacity);
+    words = nullptr;
+    size = capacity = 0;
+};
+
+inline void bit_vector::copy_from(const bit_vector& b){
+    const size_t n = b.word_count();
+    if(n > 0){
+        words = alloc.allocate(n);
+        for(size_t i = 0; i < n; ++i) words[i] = b.words[i];
+    }
+    size = b.size;
+    capacity = n;
+};
+
+#endif
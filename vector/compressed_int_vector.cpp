@@ -0,0 +1,514 @@
+#ifndef COMPRESSED_INT_VECTOR_CPP
+#define COMPRESSED_INT_VECTOR_CPP
+#include <bit>
+#include "compressed_int_vector.hpp"
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+    @file compressed_int_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the compressed_int_vector class methods.
+    The definitions are inline since the file is included wherever compressed_int_vector is used.
+*/
+
+/**
+ * @brief Constructor that initializes an empty compressed vector.
+ *
+ * @note the time complexity is O(1)
+ */
+inline compressed_int_vector::compressed_int_vector() : blocks(nullptr), block_count(0), block_capacity(0), words(nullptr), word_count(0), word_capacity(0), size(0){};
+
+/**
+ * @brief Copy constructor.
+ *
+ * @param c The compressed vector to be copied.
+ *
+ * @note the time complexity is O(c.memory_bytes())
+ */
+inline compressed_int_vector::compressed_int_vector(const compressed_int_vector& c) : compressed_int_vector(){
+    std::lock_guard<std::mutex> lock(c.mtx_);
+    copy_from(c);
+};
+
+/**
+ * @brief Move constructor. The source is left empty.
+ *
+ * @param c The compressed vector to be moved.
+ *
+ * @note the time complexity is O(block_size)
+ */
+inline compressed_int_vector::compressed_int_vector(compressed_int_vector&& c){
+    std::lock_guard<std::mutex> lock(c.mtx_);
+    blocks = c.blocks;
+    block_count = c.block_count;
+    block_capacity = c.block_capacity;
+    words = c.words;
+    word_count = c.word_count;
+    word_capacity = c.word_capacity;
+    size = c.size;
+    for(size_t i = 0; i < size % block_size; ++i) tail[i] = c.tail[i];
+
+    c.blocks = nullptr;
+    c.words = nullptr;
+    c.block_count = c.block_capacity = c.word_count = c.word_capacity = c.size = 0;
+};
+
+inline compressed_int_vector::~compressed_int_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param c The compressed vector to be copied.
+ * @return Reference to the modified compressed vector.
+ *
+ * @note the time complexity is O(c.memory_bytes())
+ */
+inline compressed_int_vector& compressed_int_vector::operator=(const compressed_int_vector& c){
+    if(this != &c){
+        std::lock(mtx_, c.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(c.mtx_, std::adopt_lock);
+
+        clean_up();
+        copy_from(c);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source is left empty.
+ *
+ * @param c The compressed vector to be moved.
+ * @return Reference to the modified compressed vector.
+ *
+ * @note the time complexity is O(block_size)
+ */
+inline compressed_int_vector& compressed_int_vector::operator=(compressed_int_vector&& c) noexcept{
+    if(this != &c){
+        std::lock(mtx_, c.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(c.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        blocks = c.blocks;
+        block_count = c.block_count;
+        block_capacity = c.block_capacity;
+        words = c.words;
+        word_count = c.word_count;
+        word_capacity = c.word_capacity;
+        size = c.size;
+        for(size_t i = 0; i < size % block_size; ++i) tail[i] = c.tail[i];
+
+        c.blocks = nullptr;
+        c.words = nullptr;
+        c.block_count = c.block_capacity = c.word_count = c.word_capacity = c.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Returns the element at the specified index, without bounds checking.
+ *
+ * @param index The position of the element.
+ * @return The element.
+ *
+ * @note the time complexity is O(1) in frame of reference blocks, O(block_size) in delta blocks
+ */
+inline uint64_t compressed_int_vector::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return read(index);
+};
+
+/**
+ * @brief Returns the element at the specified index with bounds checking.
+ *
+ * @param index The position of the element.
+ * @return The element.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1) in frame of reference blocks, O(block_size) in delta blocks
+ */
+inline uint64_t compressed_int_vector::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return read(index);
+};
+
+/**
+ * @brief Appends a value, compressing the last block once it is full.
+ *
+ * @param value The value to be added.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+inline void compressed_int_vector::push_back(uint64_t value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    push_back_unlocked(value);
+};
+
+/**
+ * @brief Appends n values read from first under a single lock acquisition.
+ *
+ * @param first Iterator to the first value to append.
+ * @param n The number of values to append.
+ *
+ * @note the time complexity is O(n)
+ */
+template<typename InputIt>
+inline void compressed_int_vector::push_back_n(InputIt first, size_t n){
+    std::lock_guard<std::mutex> lock(mtx_);
+    for(size_t i = 0; i < n; ++i, ++first) push_back_unlocked(*first);
+};
+
+/**
+ * @brief Decodes a whole block, which is how scans should read the vector.
+ *
+ * @param block The block, from 0 to get_blocks() - 1.
+ * @param out Destination of at least block_size values.
+ * @return The number of values of the block, block_size for all but the last one.
+ * @throws std::out_of_range If the block does not exist.
+ *
+ * @note the time complexity is O(block_size)
+ */
+inline size_t compressed_int_vector::decode_block(size_t block, uint64_t* out) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(block * block_size >= size) throw std::out_of_range("Out of range");
+    decode_unlocked(block, out);
+    return block < block_count ? block_size : size % block_size;
+};
+
+/**
+ * @brief Removes every element and frees the storage.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void compressed_int_vector::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    clean_up();
+};
+
+/**
+ * @brief Equality comparison operator, comparing the decoded values.
+ *
+ * @param c The compressed vector to be compared.
+ * @return True if both hold the same values.
+ *
+ * @note the time complexity is O(size)
+ */
+inline bool compressed_int_vector::operator==(const compressed_int_vector& c) const{
+    if(this == &c) return true;
+    std::lock(mtx_, c.mtx_);
+    std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(c.mtx_, std::adopt_lock);
+
+    if(size != c.size) return false;
+    uint64_t a[block_size], b[block_size];
+    for(size_t block = 0; block * block_size < size; ++block){
+        decode_unlocked(block, a);
+        c.decode_unlocked(block, b);
+        const size_t n = block < block_count ? block_size : size % block_size;
+        for(size_t i = 0; i < n; ++i){
+            if(a[i] != b[i]) return false;
+        }
+    }
+    return true;
+};
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @note the time complexity is O(size)
+ */
+inline bool compressed_int_vector::operator!=(const compressed_int_vector& c) const{
+    return !(*this == c);
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t compressed_int_vector::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Returns the number of blocks, counting the incomplete last one.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t compressed_int_vector::get_blocks() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return (size + block_size - 1) / block_size;
+};
+
+/**
+ * @brief Returns the bytes taken by the compressed blocks, their headers and the uncompressed last block.
+ *
+ * Comparing it with get_size() * 8 gives the compression ratio.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t compressed_int_vector::memory_bytes() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return word_count * sizeof(uint64_t) + block_count * sizeof(block_header) + (size % block_size) * sizeof(uint64_t);
+};
+
+/**
+ * @brief Checks if the compressed vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+inline bool compressed_int_vector::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Read-only iterator yielding the elements by value, decoding one block at a time into its own buffer.
+ */
+class compressed_int_vector::const_iterator{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = ptrdiff_t;
+        using pointer = const uint64_t*;
+        using reference = uint64_t;
+
+        const_iterator(const compressed_int_vector* c, size_t i) : owner(c), index(i), loaded(~size_t(0)){};
+
+        uint64_t operator*() const{
+            const size_t block = index / block_size;
+            if(block != loaded){
+                owner->decode_block(block, buffer);
+                loaded = block;
+            }
+            return buffer[index % block_size];
+        }
+        const_iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        bool operator==(const const_iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const{
+            return index != other.index;
+        }
+
+    private:
+        const compressed_int_vector* owner;
+        size_t index;
+        mutable size_t loaded;
+        mutable uint64_t buffer[block_size];
+};
+
+inline compressed_int_vector::const_iterator compressed_int_vector::begin() const{
+    return const_iterator(this, 0);
+};
+
+inline compressed_int_vector::const_iterator compressed_int_vector::end() const{
+    return const_iterator(this, get_size());
+};
+
+/**
+ * @brief Appends a value without locking. The caller must hold mtx_.
+ */
+inline void compressed_int_vector::push_back_unlocked(uint64_t value){
+    tail[size % block_size] = value;
+    ++size;
+    if(size % block_size == 0) seal();
+};
+
+/**
+ * @brief Encodes the full tail as a new block. The caller must hold mtx_.
+ */
+inline void compressed_int_vector::seal(){
+    bool sorted = true;
+    uint64_t low = tail[0];
+    for(size_t i = 1; i < block_size; ++i){
+        sorted &= tail[i - 1] <= tail[i];
+        if(tail[i] < low) low = tail[i];
+    }
+
+    uint64_t encoded[block_size];
+    uint64_t high = 0;
+    for(size_t i = 0; i < block_size; ++i){
+        encoded[i] = sorted ? (i == 0 ? 0 : tail[i] - tail[i - 1]) : tail[i] - low;
+        high |= encoded[i];
+    }
+    const unsigned bits = std::bit_width(high);
+    const size_t n = 2 * bits;
+
+    if(block_count == block_capacity){
+        const size_t new_capacity = block_capacity == 0 ? 16 : block_capacity * 2;
+        block_header* new_blocks = block_alloc.allocate(new_capacity);
+        for(size_t i = 0; i < block_count; ++i) new_blocks[i] = blocks[i];
+        if(blocks) block_alloc.deallocate(blocks, block_capacity);
+        blocks = new_blocks;
+        block_capacity = new_capacity;
+    }
+    if(word_count + n > word_capacity){
+        size_t new_capacity = word_capacity == 0 ? 64 : word_capacity * 2;
+        if(new_capacity < word_count + n) new_capacity = word_count + n;
+        uint64_t* new_words = alloc.allocate(new_capacity);
+        for(size_t i = 0; i < word_count; ++i) new_words[i] = words[i];
+        if(words) alloc.deallocate(words, word_capacity);
+        words = new_words;
+        word_capacity = new_capacity;
+    }
+
+    uint64_t* w = words + word_count;
+    for(size_t i = 0; i < n; ++i) w[i] = 0;
+    for(size_t i = 0; i < block_size && bits; ++i){
+        const size_t offset = i * bits;
+        const unsigned shift = offset % word_bits;
+        w[offset / word_bits] |= encoded[i] << shift;
+        if(shift + bits > word_bits) w[offset / word_bits + 1] |= encoded[i] >> (word_bits - shift);
+    }
+
+    blocks[block_count++] = block_header{sorted ? tail[0] : low, word_count, bits, sorted};
+    word_count += n;
+};
+
+/**
+ * @brief Returns element index. The caller must hold mtx_.
+ */
+inline uint64_t compressed_int_vector::read(size_t index) const{
+    const size_t block = index / block_size;
+    if(block == block_count) return tail[index % block_size];
+
+    const block_header& h = blocks[block];
+    const uint64_t* w = words + h.offset;
+    const size_t j = index % block_size;
+    if(!h.delta) return h.base + extract(w, j, h.bits);
+
+    uint64_t value = h.base;
+    for(size_t i = 1; i <= j; ++i) value += extract(w, i, h.bits);
+    return value;
+};
+
+/**
+ * @brief Decodes a block into out. The caller must hold mtx_.
+ */
+inline void compressed_int_vector::decode_unlocked(size_t block, uint64_t* out) const{
+    if(block == block_count){
+        for(size_t i = 0; i < size % block_size; ++i) out[i] = tail[i];
+        return;
+    }
+
+    const block_header& h = blocks[block];
+    const uint64_t* w = words + h.offset;
+    for(size_t i = 0; i < block_size; ++i) out[i] = h.bits ? extract(w, i, h.bits) : 0;
+
+    if(h.delta) prefix_sum(out, h.base);
+    else add_base(out, h.base);
+};
+
+inline void compressed_int_vector::clean_up(){
+    if(blocks) block_alloc.deallocate(blocks, block_capacity);
+    if(words) alloc.deallocate(words, word_capacity);
+    blocks = nullptr;
+    words = nullptr;
+    block_count = block_capacity = word_count = word_capacity = size = 0;
+};
+
+inline void compressed_int_vector::copy_from(const compressed_int_vector& c){
+    if(c.block_count > 0){
+        blocks = block_alloc.allocate(c.block_count);
+        for(size_t i = 0; i < c.block_count; ++i) blocks[i] = c.blocks[i];
+    }
+    if(c.word_count > 0){
+        words = alloc.allocate(c.word_count);
+        for(size_t i = 0; i < c.word_count; ++i) words[i] = c.words[i];
+    }
+    block_count = block_capacity = c.block_count;
+    word_count = word_capacity = c.word_count;
+    size = c.size;
+    for(size_t i = 0; i < size % block_size; ++i) tail[i] = c.tail[i];
+};
+
+/**
+ * @brief Extracts the i-th value of bits bits (1 to 64) from one or two words.
+ */
+inline uint64_t compressed_int_vector::extract(const uint64_t* w, size_t i, unsigned bits){
+    const size_t offset = i * bits;
+    const unsigned shift = offset % word_bits;
+    const uint64_t mask = bits == word_bits ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+
+    uint64_t value = w[offset / word_bits] >> shift;
+    if(shift + bits > word_bits) value |= w[offset / word_bits + 1] << (word_bits - shift);
+    return value & mask;
+};
+
+/**
+ * @brief Adds base to the block_size values of out (frame of reference decoding).
+ */
+inline void compressed_int_vector::add_base(uint64_t* out, uint64_t base){
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256i b4 = _mm256_set1_epi64x(static_cast<long long>(base));
+    for(; i + 4 <= block_size; i += 4){
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(out + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi64(v, b4));
+    }
+#endif
+#ifdef __SSE2__
+    const __m128i b2 = _mm_set1_epi64x(static_cast<long long>(base));
+    for(; i + 2 <= block_size; i += 2){
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi64(v, b2));
+    }
+#endif
+    for(; i < block_size; ++i) out[i] += base;
+};
+
+/**
+ * @brief Turns the block_size gaps of out into values starting from base (delta decoding).
+ *
+ * The vector forms compute the prefix sum inside a register with shifted adds and carry the running total
+ * across registers.
+ */
+inline void compressed_int_vector::prefix_sum(uint64_t* out, uint64_t base){
+    size_t i = 0;
+#ifdef __AVX2__
+    __m256i carry4 = _mm256_set1_epi64x(static_cast<long long>(base));
+    const __m256i zero = _mm256_setzero_si256();
+    for(; i + 4 <= block_size; i += 4){
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(out + i));
+        v = _mm256_add_epi64(v, _mm256_blend_epi32(_mm256_permute4x64_epi64(v, 0x90), zero, 0x03));
+        v = _mm256_add_epi64(v, _mm256_blend_epi32(_mm256_permute4x64_epi64(v, 0x40), zero, 0x0F));
+        v = _mm256_add_epi64(v, carry4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+        carry4 = _mm256_permute4x64_epi64(v, 0xFF);
+    }
+    base = i ? out[i - 1] : base;
+#endif
+#ifdef __SSE2__
+    __m128i carry2 = _mm_set1_epi64x(static_cast<long long>(base));
+    for(; i + 2 <= block_size; i += 2){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(out + i));
+        v = _mm_add_epi64(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi64(v, carry2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+        carry2 = _mm_shuffle_epi32(v, 0xEE);
+    }
+    base = i ? out[i - 1] : base;
+#endif
+    for(; i < block_size; ++i){
+        base += out[i];
+        out[i] = base;
+    }
+};
+
+#endif
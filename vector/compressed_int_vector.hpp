@@ -0,0 +1,95 @@
+#ifndef COMPRESSED_INT_VECTOR_HPP
+#define COMPRESSED_INT_VECTOR_HPP
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file compressed_int_vector.hpp
+ * @brief Thread-safe, append-only vector of 64 bit unsigned integers compressed in blocks of 128.
+ *
+ * Every full block is encoded on its own: a non-decreasing block (sorted ids, timestamps) stores the gaps
+ * between consecutive values, any other block stores the distance of every value from the block minimum
+ * (frame of reference). The encoded values are bit-packed with the width of the largest one, so a block takes
+ * exactly 2 * bits words plus a small header. The last, incomplete block is kept uncompressed.
+ *
+ * Blocks start at known word offsets, so locating a block is O(1). Decoding a whole block unpacks it and adds
+ * the base (or prefix-sums the gaps) with AVX2 or SSE2 when available, which is what scans go through: the
+ * const_iterator decodes one block at a time and is a drop-in for vector's const_iterator in range loops.
+ *
+ * As in vector, every operation locks the compressed vector.
+ *
+ * @author Andrea Maggetto
+ */
+
+class compressed_int_vector{
+    public:
+        static constexpr size_t block_size = 128;
+
+        class const_iterator;
+
+    private:
+        static constexpr size_t word_bits = 64;
+
+        struct block_header{
+            uint64_t base;
+            size_t offset;
+            unsigned bits;
+            bool delta;
+        };
+
+        block_header* blocks;
+        size_t block_count, block_capacity;
+        uint64_t* words;
+        size_t word_count, word_capacity;
+        uint64_t tail[block_size];
+        size_t size;
+        allocator<block_header> block_alloc;
+        allocator<uint64_t> alloc;
+        mutable std::mutex mtx_;
+
+        void push_back_unlocked(uint64_t value);
+        void seal();
+        uint64_t read(size_t index) const;
+        void decode_unlocked(size_t block, uint64_t* out) const;
+        void clean_up();
+        void copy_from(const compressed_int_vector& c);
+
+        static uint64_t extract(const uint64_t* w, size_t i, unsigned bits);
+        static void add_base(uint64_t* out, uint64_t base);
+        static void prefix_sum(uint64_t* out, uint64_t base);
+
+    public:
+        compressed_int_vector();
+        compressed_int_vector(const compressed_int_vector& c);
+        compressed_int_vector(compressed_int_vector&& c);
+        ~compressed_int_vector();
+
+        compressed_int_vector& operator=(const compressed_int_vector& c);
+        compressed_int_vector& operator=(compressed_int_vector&& c) noexcept;
+
+        uint64_t operator[](const size_t index) const;
+        uint64_t at(const size_t index) const;
+
+        void push_back(uint64_t value);
+        template<typename InputIt>
+        void push_back_n(InputIt first, size_t n);
+        size_t decode_block(size_t block, uint64_t* out) const;
+        void clear();
+
+        bool operator==(const compressed_int_vector& c) const;
+        bool operator!=(const compressed_int_vector& c) const;
+
+        size_t get_size() const;
+        size_t get_blocks() const;
+        size_t memory_bytes() const;
+        bool empty() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
@@ -0,0 +1,385 @@
+#include "cow_vector.hpp"
+
+/*
+    @file cow_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the cow_vector class methods
+*/
+
+/**
+ * @class reference
+ * @brief Proxy returned by the non-const operator[]: reading it never detaches, assigning to it goes through set().
+ */
+template<typename T>
+class cow_vector<T>::reference{
+    public:
+        reference(cow_vector<T>& v, size_t i) : owner(&v), index(i){};
+
+        operator T() const{
+            return owner->cget(index);
+        }
+        reference& operator=(const T& value){
+            owner->set(index, value);
+            return *this;
+        }
+        reference& operator=(const reference& r){
+            owner->set(index, static_cast<T>(r));
+            return *this;
+        }
+
+    private:
+        cow_vector<T>* owner;
+        size_t index;
+};
+
+/**
+ * @brief Default constructor. Creates an empty, unshared buffer.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+cow_vector<T>::cow_vector() : buffer(std::make_shared<vector<T>>()){};
+
+/**
+ * @brief Constructor that initializes the buffer with init_size copies of init.
+ * 
+ * @note the time complexity is O(init_size)
+ */
+template<typename T>
+cow_vector<T>::cow_vector(const T& init, size_t init_size) : buffer(std::make_shared<vector<T>>(init, init_size)){};
+
+/**
+ * @brief Copy constructor. Shares the buffer of v instead of copying the elements, unless v handed out
+ * mutable iterators to it.
+ * 
+ * @note the time complexity is O(1), O(size) if the buffer of v is unshareable
+ */
+template<typename T>
+cow_vector<T>::cow_vector(const cow_vector<T>& v) : buffer(v.share()){};
+
+/**
+ * @brief Move constructor. The source is left with a fresh empty buffer.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+cow_vector<T>::cow_vector(cow_vector<T>&& v){
+    std::lock_guard<std::mutex> lock(v.mtx_);
+    buffer = std::move(v.buffer);
+    unshareable = v.unshareable;
+    v.buffer = std::make_shared<vector<T>>();
+    v.unshareable = false;
+};
+
+/**
+ * @brief Copy assignment operator. Shares the buffer of v instead of copying the elements, unless v handed
+ * out mutable iterators to it.
+ * 
+ * @note the time complexity is O(1), O(size) if the buffer of v is unshareable
+ */
+template<typename T>
+cow_vector<T>& cow_vector<T>::operator=(const cow_vector<T>& v){
+    if(this != &v){
+        std::shared_ptr<vector<T>> shared_buffer = v.share();
+        std::lock_guard<std::mutex> lock(mtx_);
+        buffer.swap(shared_buffer);
+        unshareable = false;
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source is left with a fresh empty buffer.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+cow_vector<T>& cow_vector<T>::operator=(cow_vector<T>&& v) noexcept{
+    if(this != &v){
+        std::lock(mtx_, v.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(v.mtx_, std::adopt_lock);
+
+        buffer = std::move(v.buffer);
+        unshareable = v.unshareable;
+        v.buffer = std::make_shared<vector<T>>();
+        v.unshareable = false;
+    }
+    return *this;
+};
+
+/**
+ * @brief Returns the buffer for writing, detaching it first if other instances share it.
+ * The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(size) when detaching, O(1) otherwise
+ */
+template<typename T>
+vector<T>& cow_vector<T>::writable(){
+    //instances sharing the buffer can only copy it through our mtx_, so a count of 1 cannot grow under us
+    if(buffer.use_count() > 1) buffer = std::make_shared<vector<T>>(*buffer);
+    return *buffer;
+};
+
+/**
+ * @brief Returns the buffer for writing through a reference or iterator that outlives the call, and marks
+ * it unshareable so that no later copy can observe those writes. The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(size) when detaching, O(1) otherwise
+ */
+template<typename T>
+vector<T>& cow_vector<T>::leak(){
+    vector<T>& writable_buffer = writable();
+    unshareable = true;
+    return writable_buffer;
+};
+
+/**
+ * @brief Returns the buffer a copy of this instance should refer to: the current one, or a deep copy of it
+ * if mutable iterators to it escaped.
+ * 
+ * @note the time complexity is O(1), O(size) if the buffer is unshareable
+ */
+template<typename T>
+std::shared_ptr<vector<T>> cow_vector<T>::share() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(unshareable) return std::make_shared<vector<T>>(*buffer);
+    return buffer;
+};
+
+/**
+ * @brief Takes a reference on the current buffer so that it can be read without holding mtx_.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+std::shared_ptr<const vector<T>> cow_vector<T>::shared() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer;
+};
+
+/**
+ * @brief Const indexing operator, without bounds checking. Never detaches.
+ * 
+ * @note The time complexity is O(1).
+ */
+template<typename T>
+const T& cow_vector<T>::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return static_cast<const vector<T>&>(*buffer)[index];
+};
+
+/**
+ * @brief Indexing operator, without bounds checking. Returns a proxy that reads the element without detaching
+ * and writes it through set().
+ * 
+ * @note The time complexity is O(1), O(size) on the first write after a copy.
+ */
+template<typename T>
+typename cow_vector<T>::reference cow_vector<T>::operator[](const size_t index){
+    return reference(*this, index);
+};
+
+/**
+ * @brief Equality comparison operator. Instances sharing a buffer compare equal without looking at the elements.
+ * 
+ * @note the time complexity is O(size)
+ */
+template<typename T>
+bool cow_vector<T>::operator==(const cow_vector<T>& v) const{
+    std::shared_ptr<const vector<T>> mine = shared();
+    std::shared_ptr<const vector<T>> other = v.shared();
+    return mine == other || *mine == *other;
+};
+
+/**
+ * @brief Inequality comparison operator.
+ * 
+ * @note the time complexity is O(size)
+ */
+template<typename T>
+bool cow_vector<T>::operator!=(const cow_vector<T>& v) const{
+    return !(*this == v);
+};
+
+/**
+ * @brief Returns the current size of the vector.
+ * 
+ * @note The time complexity is O(1)
+ */
+template<typename T>
+size_t cow_vector<T>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer->get_size();
+};
+
+/**
+ * @brief Adds an element to the end of the vector, detaching a shared buffer first.
+ * 
+ * @note the time complexity is O(1) amortized, O(size) on the first write after a copy
+ */
+template<typename T>
+void cow_vector<T>::push_back(const T& el){
+    std::lock_guard<std::mutex> lock(mtx_);
+    writable().push_back(el);
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ * 
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& cow_vector<T>::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer->at(index);
+};
+
+/**
+ * @brief Reads an element without bounds checking, even through a non-const instance. Never detaches.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& cow_vector<T>::cget(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return static_cast<const vector<T>&>(*buffer)[index];
+};
+
+/**
+ * @brief Replaces the element at the specified index, detaching a shared buffer first. The buffer stays shareable.
+ * 
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(1), O(size) on the first write after a copy
+ */
+template<typename T>
+void cow_vector<T>::set(const size_t index, const T& value){
+    std::lock_guard<std::mutex> lock(mtx_);
+    writable().at(index) = value;
+};
+
+/**
+ * @brief Modifies the element at the specified index in place by calling f on it, detaching a shared buffer
+ * first. The reference passed to f must not be kept after f returns; the buffer stays shareable.
+ * 
+ * @param f Callable taking a T&, run while the vector is locked.
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(1) plus the cost of f, O(size) on the first write after a copy
+ */
+template<typename T>
+template<typename F>
+void cow_vector<T>::update(const size_t index, F f){
+    std::lock_guard<std::mutex> lock(mtx_);
+    f(writable().at(index));
+};
+
+/**
+ * @brief Checks if the vector is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool cow_vector<T>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer->empty();
+};
+
+/**
+ * @brief Accesses the last element of the vector.
+ * 
+ * @throws std::out_of_range If the vector is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& cow_vector<T>::back() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer->back();
+};
+
+/**
+ * @brief Accesses the first element of the vector.
+ * 
+ * @throws std::out_of_range If the vector is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& cow_vector<T>::front() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer->front();
+};
+
+/**
+ * @brief Clears the vector. A shared buffer is simply released instead of being copied and cleared.
+ * References handed out before are invalidated, so the buffer becomes shareable again.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+void cow_vector<T>::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(buffer.use_count() > 1) buffer = std::make_shared<vector<T>>();
+    else buffer->clear();
+    unshareable = false;
+};
+
+/**
+ * @brief Checks whether the buffer is currently shared with other instances, i.e. whether the next write will copy.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool cow_vector<T>::is_shared() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return buffer.use_count() > 1;
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the beginning of the vector. Never detaches.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename cow_vector<T>::const_iterator cow_vector<T>::begin() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return static_cast<const vector<T>&>(*buffer).begin();
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the end of the vector. Never detaches.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename cow_vector<T>::const_iterator cow_vector<T>::end() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return static_cast<const vector<T>&>(*buffer).end();
+};
+
+/**
+ * @brief Creates an iterator pointing to the beginning of the vector, for writing through it. Detaches a shared
+ * buffer and marks it unshareable.
+ * 
+ * @note the time complexity is O(1), O(size) on the first write after a copy
+ */
+template<typename T>
+typename cow_vector<T>::iterator cow_vector<T>::mutable_begin(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return leak().begin();
+};
+
+/**
+ * @brief Creates an iterator pointing to the end of the vector, for writing through it. Detaches a shared
+ * buffer and marks it unshareable.
+ * 
+ * @note the time complexity is O(1), O(size) on the first write after a copy
+ */
+template<typename T>
+typename cow_vector<T>::iterator cow_vector<T>::mutable_end(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return leak().end();
+};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+#include <memory>
+#include <mutex>
+#include "vector.cpp"
+
+/**
+ * @file cow_vector.hpp
+ * @brief Copy-on-write variant of the vector class.
+ *
+ * Every cow_vector refers to a buffer shared through a reference count, so copying one is O(1) and gives
+ * the copy a consistent snapshot of the elements. The first mutating operation on a shared buffer detaches
+ * it by deep-copying the elements once; later writes run at full speed until the buffer is shared again.
+ * This makes it cheap to hand snapshots to readers while a single writer keeps mutating its own instance.
+ *
+ * Elements are modified through set() and update(), or by assigning through the proxy returned by the non-const
+ * operator[]: each write detaches a shared buffer and nothing escapes the call, so copies stay O(1). Reads never
+ * detach, whether through cget(), either operator[] or begin()/end(), which always return const iterators.
+ *
+ * @note mutable_begin() and mutable_end() hand out iterators that can write after the call. They detach and mark
+ * the buffer unshareable, so that later copies deep-copy it instead of sharing it until clear() or assignment.
+ * 
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class cow_vector{
+    std::shared_ptr<vector<T>> buffer;
+    bool unshareable = false;
+    mutable std::mutex mtx_;
+
+    vector<T>& writable();
+    vector<T>& leak();
+    std::shared_ptr<vector<T>> share() const;
+    std::shared_ptr<const vector<T>> shared() const;
+
+    public:
+        class reference;
+        using iterator = typename vector<T>::iterator;
+        using const_iterator = typename vector<T>::const_iterator;
+
+        cow_vector();
+        cow_vector(const T& init, size_t init_size);
+        cow_vector(const cow_vector<T>& v);
+        cow_vector(cow_vector<T>&& v);
+
+        cow_vector<T>& operator=(const cow_vector<T>& v);
+        cow_vector<T>& operator=(cow_vector<T>&& v) noexcept;
+        const T& operator[](const size_t index) const;
+        reference operator[](const size_t index);
+
+        bool operator==(const cow_vector<T>& v) const;
+        bool operator!=(const cow_vector<T>& v) const;
+
+        size_t get_size() const;
+        void push_back(const T& el);
+        const T& at(const size_t index) const;
+        const T& cget(const size_t index) const;
+        void set(const size_t index, const T& value);
+        template<typename F>
+        void update(const size_t index, F f);
+        bool empty() const;
+        const T& back() const;
+        const T& front() const;
+        void clear();
+        bool is_shared() const;
+        const_iterator begin() const;
+        const_iterator end() const;
+        iterator mutable_begin();
+        iterator mutable_end();
+};
+
+#endif
@@ -0,0 +1,246 @@
+#include "flat_map.hpp"
+#include <algorithm>
+
+/*
+    @file flat_map.cpp
+    @brief The current cpp source file contains the actual implementation of the flat_map class methods
+*/
+
+template<typename K, typename V, typename Compare>
+const typename flat_map<K, V, Compare>::entry* flat_map<K, V, Compare>::elements() const{
+    return entries.empty() ? nullptr : &*entries.begin();
+};
+
+template<typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::entry* flat_map<K, V, Compare>::elements(){
+    return entries.empty() ? nullptr : &*entries.begin();
+};
+
+/**
+ * @brief Returns the first entry whose key is not ordered before key. The caller must hold mtx_.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename K, typename V, typename Compare>
+const typename flat_map<K, V, Compare>::entry* flat_map<K, V, Compare>::search(const K& key) const{
+    return branchless_lower_bound(elements(), entries.get_size(), key, less, [](const entry& e) -> const K&{ return e.first; });
+};
+
+/**
+ * @brief Sorts the entries by key and removes duplicated keys, keeping the first entry of each key.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::sort_unique(){
+    const size_t n = entries.get_size();
+    if(n == 0) return;
+
+    entry* first = elements();
+    std::stable_sort(first, first + n, [this](const entry& a, const entry& b){ return less(a.first, b.first); });
+
+    entry* last = std::unique(first, first + n, [this](const entry& a, const entry& b){
+        return !less(a.first, b.first) && !less(b.first, a.first);
+    });
+    for(size_t extra = (first + n) - last; extra > 0; --extra) entries.pop_back();
+};
+
+/**
+ * @brief Default constructor. Creates an empty map.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Compare>
+flat_map<K, V, Compare>::flat_map() = default;
+
+/**
+ * @brief Bulk-builds the map from unsorted pairs. For duplicated keys the first pair wins.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename K, typename V, typename Compare>
+flat_map<K, V, Compare>::flat_map(const vector<entry>& unsorted) : entries(unsorted){
+    sort_unique();
+};
+
+/**
+ * @brief Bulk-builds the map from an unsorted range of pairs. For duplicated keys the first pair wins.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename K, typename V, typename Compare>
+template<typename InputIt>
+flat_map<K, V, Compare>::flat_map(InputIt first, InputIt last){
+    for(; first != last; ++first) entries.push_back(*first);
+    sort_unique();
+};
+
+/**
+ * @brief Inserts the pair if key is not already present.
+ *
+ * @return True if the pair was inserted.
+ * 
+ * @note the time complexity is O(n), O(log n) when the key is present or larger than every key
+ */
+template<typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::insert(const K& key, const V& value){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = entries.get_size();
+    const entry* pos = search(key);
+    const size_t index = pos - elements();
+    if(index < n && !less(key, pos->first)) return false;
+
+    entries.push_back(entry(key, value));
+    entry* first = elements();
+    std::rotate(first + index, first + n, first + n + 1);
+
+    return true;
+};
+
+/**
+ * @brief Inserts the pair, or replaces the value if key is already present.
+ * 
+ * @note the time complexity is O(n), O(log n) when the key is present
+ */
+template<typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::insert_or_assign(const K& key, const V& value){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = entries.get_size();
+    const size_t index = search(key) - elements();
+    entry* first = elements();
+    if(index < n && !less(key, first[index].first)){
+        first[index].second = value;
+        return;
+    }
+
+    entries.push_back(entry(key, value));
+    first = elements();
+    std::rotate(first + index, first + n, first + n + 1);
+};
+
+/**
+ * @brief Removes the pair with the given key if present.
+ *
+ * @return True if a pair was removed.
+ * 
+ * @note the time complexity is O(n)
+ */
+template<typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::erase(const K& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = entries.get_size();
+    const size_t index = search(key) - elements();
+    entry* first = elements();
+    if(index == n || less(key, first[index].first)) return false;
+
+    std::move(first + index + 1, first + n, first + index);
+    entries.pop_back();
+
+    return true;
+};
+
+/**
+ * @brief Looks key up without throwing.
+ *
+ * @return An iterator to the pair, or end() if the key is not present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator flat_map<K, V, Compare>::find(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const entry* pos = search(key);
+    if(pos == elements() + entries.get_size() || less(key, pos->first)) return entries.end();
+
+    return const_iterator(pos);
+};
+
+/**
+ * @brief Returns a copy of the value mapped to key, or an empty optional if the key is not present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename K, typename V, typename Compare>
+std::optional<V> flat_map<K, V, Compare>::get(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const entry* pos = search(key);
+    if(pos == elements() + entries.get_size() || less(key, pos->first)) return std::nullopt;
+
+    return pos->second;
+};
+
+/**
+ * @brief Accesses the value mapped to key.
+ *
+ * @throws std::out_of_range If the key is not present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename K, typename V, typename Compare>
+const V& flat_map<K, V, Compare>::at(const K& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const entry* pos = search(key);
+    if(pos == elements() + entries.get_size() || less(key, pos->first)) throw std::out_of_range("Key not found!");
+
+    return pos->second;
+};
+
+/**
+ * @brief Checks whether key is present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::contains(const K& key) const{
+    return find(key) != end();
+};
+
+/**
+ * @brief Returns the number of pairs.
+ * 
+ * @note The time complexity is O(1)
+ */
+template<typename K, typename V, typename Compare>
+size_t flat_map<K, V, Compare>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return entries.get_size();
+};
+
+/**
+ * @brief Checks if the map is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return entries.empty();
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the pair with the smallest key.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator flat_map<K, V, Compare>::begin() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return entries.begin();
+};
+
+/**
+ * @brief Creates a constant iterator pointing past the pair with the largest key.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator flat_map<K, V, Compare>::end() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return entries.end();
+};
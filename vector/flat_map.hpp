@@ -0,0 +1,56 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "vector.cpp"
+#include "sorted_search.hpp"
+
+/**
+ * @file flat_map.hpp
+ * @brief Sorted associative container stored contiguously in a vector of key/value pairs.
+ *
+ * The pairs are kept sorted by key in a single vector, so lookups are a branchless O(log n) binary search over
+ * contiguous memory. Lookups never throw on a miss: find() returns end() and get() an empty optional; only at()
+ * throws, like vector::at. Bulk building from unsorted pairs sorts once and keeps the first pair of each key.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename K, typename V, typename Compare = std::less<K>>
+class flat_map{
+    using entry = std::pair<K, V>;
+
+    vector<entry> entries;
+    Compare less;
+    mutable std::mutex mtx_;
+
+    const entry* elements() const;
+    entry* elements();
+    const entry* search(const K& key) const;
+    void sort_unique();
+
+    public:
+        using const_iterator = typename vector<entry>::const_iterator;
+
+        flat_map();
+        explicit flat_map(const vector<entry>& unsorted);
+        template<typename InputIt>
+        flat_map(InputIt first, InputIt last);
+
+        bool insert(const K& key, const V& value);
+        void insert_or_assign(const K& key, const V& value);
+        bool erase(const K& key);
+        const_iterator find(const K& key) const;
+        std::optional<V> get(const K& key) const;
+        const V& at(const K& key) const;
+        bool contains(const K& key) const;
+
+        size_t get_size() const;
+        bool empty() const;
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
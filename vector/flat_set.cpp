@@ -0,0 +1,209 @@
+#include "flat_set.hpp"
+#include <algorithm>
+
+/*
+    @file flat_set.cpp
+    @brief The current cpp source file contains the actual implementation of the flat_set class methods
+*/
+
+/**
+ * @brief Returns the contiguous storage of the keys.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Compare>
+const T* flat_set<T, Compare>::elements() const{
+    return keys.empty() ? nullptr : &*keys.begin();
+};
+
+template<typename T, typename Compare>
+T* flat_set<T, Compare>::elements(){
+    return keys.empty() ? nullptr : &*keys.begin();
+};
+
+/**
+ * @brief Sorts the keys and removes duplicates, keeping the first occurrence of each key.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename T, typename Compare>
+void flat_set<T, Compare>::sort_unique(){
+    const size_t n = keys.get_size();
+    if(n == 0) return;
+
+    T* first = elements();
+    std::stable_sort(first, first + n, less);
+
+    T* last = std::unique(first, first + n, [this](const T& a, const T& b){ return !less(a, b) && !less(b, a); });
+    for(size_t extra = (first + n) - last; extra > 0; --extra) keys.pop_back();
+};
+
+/**
+ * @brief Default constructor. Creates an empty set.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Compare>
+flat_set<T, Compare>::flat_set() = default;
+
+/**
+ * @brief Bulk-builds the set from unsorted keys, which may contain duplicates.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename T, typename Compare>
+flat_set<T, Compare>::flat_set(const vector<T>& unsorted) : keys(unsorted){
+    sort_unique();
+};
+
+/**
+ * @brief Bulk-builds the set from an unsorted range, which may contain duplicates.
+ * 
+ * @note the time complexity is O(n log n)
+ */
+template<typename T, typename Compare>
+template<typename InputIt>
+flat_set<T, Compare>::flat_set(InputIt first, InputIt last){
+    for(; first != last; ++first) keys.push_back(*first);
+    sort_unique();
+};
+
+/**
+ * @brief Inserts key if it is not already present.
+ *
+ * @return True if the key was inserted.
+ * 
+ * @note the time complexity is O(n), O(log n) when the key is present or larger than every key
+ */
+template<typename T, typename Compare>
+bool flat_set<T, Compare>::insert(const T& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = keys.get_size();
+    const T* pos = branchless_lower_bound(elements(), n, key, less, [](const T& k) -> const T&{ return k; });
+    const size_t index = pos - elements();
+    if(index < n && !less(key, *pos)) return false;
+
+    keys.push_back(key);
+    T* first = elements();
+    std::rotate(first + index, first + n, first + n + 1);
+
+    return true;
+};
+
+/**
+ * @brief Removes key if it is present.
+ *
+ * @return True if the key was removed.
+ * 
+ * @note the time complexity is O(n)
+ */
+template<typename T, typename Compare>
+bool flat_set<T, Compare>::erase(const T& key){
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = keys.get_size();
+    T* first = elements();
+    T* pos = const_cast<T*>(branchless_lower_bound(static_cast<const T*>(first), n, key, less, [](const T& k) -> const T&{ return k; }));
+    if(pos == first + n || less(key, *pos)) return false;
+
+    std::move(pos + 1, first + n, pos);
+    keys.pop_back();
+
+    return true;
+};
+
+/**
+ * @brief Looks key up without throwing.
+ *
+ * @return An iterator to the key, or end() if it is not present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename T, typename Compare>
+typename flat_set<T, Compare>::const_iterator flat_set<T, Compare>::find(const T& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const size_t n = keys.get_size();
+    const T* pos = branchless_lower_bound(elements(), n, key, less, [](const T& k) -> const T&{ return k; });
+    if(pos == elements() + n || less(key, *pos)) return keys.end();
+
+    return const_iterator(pos);
+};
+
+/**
+ * @brief Returns an iterator to the first key not ordered before key.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename T, typename Compare>
+typename flat_set<T, Compare>::const_iterator flat_set<T, Compare>::lower_bound(const T& key) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(keys.empty()) return keys.end();
+    return const_iterator(branchless_lower_bound(elements(), keys.get_size(), key, less, [](const T& k) -> const T&{ return k; }));
+};
+
+/**
+ * @brief Checks whether key is present.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename T, typename Compare>
+bool flat_set<T, Compare>::contains(const T& key) const{
+    return find(key) != end();
+};
+
+/**
+ * @brief Accesses the index-th smallest key, without bounds checking.
+ * 
+ * @note The time complexity is O(1).
+ */
+template<typename T, typename Compare>
+const T& flat_set<T, Compare>::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return elements()[index];
+};
+
+/**
+ * @brief Returns the number of keys.
+ * 
+ * @note The time complexity is O(1)
+ */
+template<typename T, typename Compare>
+size_t flat_set<T, Compare>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys.get_size();
+};
+
+/**
+ * @brief Checks if the set is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Compare>
+bool flat_set<T, Compare>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys.empty();
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the smallest key.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Compare>
+typename flat_set<T, Compare>::const_iterator flat_set<T, Compare>::begin() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys.begin();
+};
+
+/**
+ * @brief Creates a constant iterator pointing past the largest key.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Compare>
+typename flat_set<T, Compare>::const_iterator flat_set<T, Compare>::end() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys.end();
+};
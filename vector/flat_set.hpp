@@ -0,0 +1,51 @@
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+#include <functional>
+#include <mutex>
+#include "vector.cpp"
+#include "sorted_search.hpp"
+
+/**
+ * @file flat_set.hpp
+ * @brief Sorted set stored contiguously in a vector.
+ *
+ * The keys are kept sorted and unique in a single vector, so lookups are a branchless O(log n) binary search
+ * over contiguous memory instead of a pointer chase. find() never throws: a miss returns end(). Inserting or
+ * erasing a single key shifts the tail of the storage, so bulk building from unsorted input (sort once,
+ * then drop duplicates) is the intended way of filling a large set.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T, typename Compare = std::less<T>>
+class flat_set{
+    vector<T> keys;
+    Compare less;
+    mutable std::mutex mtx_;
+
+    const T* elements() const;
+    T* elements();
+    void sort_unique();
+
+    public:
+        using const_iterator = typename vector<T>::const_iterator;
+
+        flat_set();
+        explicit flat_set(const vector<T>& unsorted);
+        template<typename InputIt>
+        flat_set(InputIt first, InputIt last);
+
+        bool insert(const T& key);
+        bool erase(const T& key);
+        const_iterator find(const T& key) const;
+        const_iterator lower_bound(const T& key) const;
+        bool contains(const T& key) const;
+
+        const T& operator[](const size_t index) const;
+        size_t get_size() const;
+        bool empty() const;
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
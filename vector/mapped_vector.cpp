@@ -0,0 +1,205 @@
+#include "mapped_vector.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    @file mapped_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the mapped_vector class methods
+*/
+
+/**
+ * @brief Maps a snapshot file written by vector::save.
+ *
+ * Only the header is validated, the payload checksum is checked on demand by verify() so that opening
+ * does not touch every page.
+ *
+ * @param path The snapshot file.
+ * @throws std::runtime_error If the file cannot be mapped or is not a snapshot of T.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+mapped_vector<T>::mapped_vector(const std::string& path) : mapping(nullptr), mapping_size(0), data(nullptr), size(0), checksum(0){
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0) throw std::runtime_error("Cannot open " + path);
+
+    struct stat st;
+    if(::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(snapshot_header)){
+        ::close(fd);
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+
+    mapping_size = static_cast<size_t>(st.st_size);
+    mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(mapping == MAP_FAILED){
+        mapping = nullptr;
+        throw std::runtime_error("Cannot map " + path);
+    }
+
+    const snapshot_header* header = static_cast<const snapshot_header*>(mapping);
+    if(!header->compatible(sizeof(T)) || header->count > (mapping_size - sizeof(snapshot_header)) / sizeof(T)){
+        clean_up();
+        throw std::runtime_error("Invalid snapshot " + path);
+    }
+
+    size = header->count;
+    checksum = header->checksum;
+    data = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(snapshot_header));
+};
+
+/**
+ * @brief Move constructor. The source view is left empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+mapped_vector<T>::mapped_vector(mapped_vector<T>&& mv) noexcept : mapping(mv.mapping), mapping_size(mv.mapping_size), data(mv.data), size(mv.size), checksum(mv.checksum){
+    mv.mapping = nullptr;
+    mv.data = nullptr;
+    mv.mapping_size = mv.size = 0;
+};
+
+/**
+ * @brief Destructor. Unmaps the snapshot file.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+mapped_vector<T>::~mapped_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Move assignment operator. The source view is left empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+mapped_vector<T>& mapped_vector<T>::operator=(mapped_vector<T>&& mv) noexcept{
+    if(this != &mv){
+        clean_up();
+
+        mapping = mv.mapping;
+        mapping_size = mv.mapping_size;
+        data = mv.data;
+        size = mv.size;
+        checksum = mv.checksum;
+
+        mv.mapping = nullptr;
+        mv.data = nullptr;
+        mv.mapping_size = mv.size = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Const indexing operator, without bounds checking.
+ *
+ * @note The time complexity is O(1).
+ */
+template<typename T>
+const T& mapped_vector<T>::operator[](const size_t index) const{
+    return data[index];
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& mapped_vector<T>::at(const size_t index) const{
+    if(index >= size) throw std::out_of_range("Out of range");
+    return data[index];
+};
+
+/**
+ * @brief Accesses the first element.
+ *
+ * @throws std::out_of_range If the view is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& mapped_vector<T>::front() const{
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return data[0];
+};
+
+/**
+ * @brief Accesses the last element.
+ *
+ * @throws std::out_of_range If the view is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& mapped_vector<T>::back() const{
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return data[size - 1];
+};
+
+/**
+ * @brief Returns the number of mapped elements.
+ *
+ * @note The time complexity is O(1)
+ */
+template<typename T>
+size_t mapped_vector<T>::get_size() const{
+    return size;
+};
+
+/**
+ * @brief Checks if the view is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool mapped_vector<T>::empty() const{
+    return size == 0;
+};
+
+/**
+ * @brief Recomputes the payload checksum and compares it with the one stored in the header.
+ *
+ * @return True if the snapshot is intact.
+ * 
+ * @note the time complexity is O(size), every page of the snapshot is read
+ */
+template<typename T>
+bool mapped_vector<T>::verify() const{
+    return snapshot_checksum(data, size * sizeof(T)) == checksum;
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the first mapped element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename mapped_vector<T>::const_iterator mapped_vector<T>::begin() const{
+    return const_iterator(data);
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the element after the last mapped one.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename mapped_vector<T>::const_iterator mapped_vector<T>::end() const{
+    return const_iterator(data + size);
+};
+
+template<typename T>
+void mapped_vector<T>::clean_up(){
+    if(mapping) ::munmap(mapping, mapping_size);
+    mapping = nullptr;
+    data = nullptr;
+    mapping_size = size = 0;
+};
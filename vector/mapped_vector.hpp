@@ -0,0 +1,57 @@
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include "vector.cpp"
+
+/**
+ * @file mapped_vector.hpp
+ * @brief Read-only, zero-copy view over a snapshot written by vector::save.
+ *
+ * The snapshot file is memory-mapped and the elements are used in place, so opening a multi-GB snapshot
+ * only validates the header and costs no copy: pages are faulted in lazily on first access. The view is
+ * immutable, therefore concurrent readers need no locking. It exposes the same const_iterator and indexing
+ * API as vector.
+ *
+ * @note Only trivially copyable element types can be mapped.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class mapped_vector{
+    static_assert(std::is_trivially_copyable<T>::value, "mapped_vector requires a trivially copyable T");
+
+    void* mapping;
+    size_t mapping_size;
+    const T* data;
+    size_t size;
+    uint64_t checksum;
+
+    void clean_up();
+
+    public:
+        using const_iterator = typename vector<T>::const_iterator;
+
+        explicit mapped_vector(const std::string& path);
+        mapped_vector(const mapped_vector<T>& mv) = delete;
+        mapped_vector(mapped_vector<T>&& mv) noexcept;
+        ~mapped_vector();
+
+        mapped_vector<T>& operator=(const mapped_vector<T>& mv) = delete;
+        mapped_vector<T>& operator=(mapped_vector<T>&& mv) noexcept;
+
+        const T& operator[](const size_t index) const;
+        const T& at(const size_t index) const;
+        const T& front() const;
+        const T& back() const;
+        size_t get_size() const;
+        bool empty() const;
+        bool verify() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
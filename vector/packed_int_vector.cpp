@@ -0,0 +1,401 @@
+#ifndef PACKED_INT_VECTOR_CPP
+#define PACKED_INT_VECTOR_CPP
+#include "packed_int_vector.hpp"
+
+/*
+    @file packed_int_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the packed_int_vector class methods.
+    The definitions are inline since the file is included wherever packed_int_vector is used.
+*/
+
+/**
+ * @brief Constructor that initializes an empty packed vector.
+ *
+ * @param element_bits The width of every element, from 1 to 64.
+ * @throws std::invalid_argument If element_bits is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline packed_int_vector::packed_int_vector(unsigned element_bits) : words(nullptr), size(0), capacity(0), bits(element_bits){
+    if(bits == 0 || bits > word_bits) throw std::invalid_argument("Element width must be between 1 and 64 bits");
+    mask = bits == word_bits ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+};
+
+/**
+ * @brief Constructor that initializes n elements to value.
+ *
+ * @param element_bits The width of every element, from 1 to 64.
+ * @param n The number of elements.
+ * @param value The initial value of every element.
+ * @throws std::invalid_argument If element_bits is out of range or value does not fit.
+ *
+ * @note the time complexity is O(n)
+ */
+inline packed_int_vector::packed_int_vector(unsigned element_bits, size_t n, uint64_t value) : packed_int_vector(element_bits){
+    resize(n, value);
+};
+
+/**
+ * @brief Copy constructor.
+ *
+ * @param p The packed vector to be copied.
+ *
+ * @note the time complexity is O(p.size * p.bits / 64)
+ */
+inline packed_int_vector::packed_int_vector(const packed_int_vector& p) : words(nullptr), size(0), capacity(0){
+    std::lock_guard<std::mutex> lock(p.mtx_);
+    copy_from(p);
+};
+
+/**
+ * @brief Move constructor. The source is left empty, with the same element width.
+ *
+ * @param p The packed vector to be moved.
+ *
+ * @note the time complexity is O(1)
+ */
+inline packed_int_vector::packed_int_vector(packed_int_vector&& p){
+    std::lock_guard<std::mutex> lock(p.mtx_);
+    words = p.words;
+    size = p.size;
+    capacity = p.capacity;
+    bits = p.bits;
+    mask = p.mask;
+    p.words = nullptr;
+    p.size = p.capacity = 0;
+};
+
+inline packed_int_vector::~packed_int_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator. The element width is copied too.
+ *
+ * @param p The packed vector to be copied.
+ * @return Reference to the modified packed vector.
+ *
+ * @note the time complexity is O(p.size * p.bits / 64)
+ */
+inline packed_int_vector& packed_int_vector::operator=(const packed_int_vector& p){
+    if(this != &p){
+        std::lock(mtx_, p.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(p.mtx_, std::adopt_lock);
+
+        clean_up();
+        copy_from(p);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source is left empty, with the same element width.
+ *
+ * @param p The packed vector to be moved.
+ * @return Reference to the modified packed vector.
+ *
+ * @note the time complexity is O(1)
+ */
+inline packed_int_vector& packed_int_vector::operator=(packed_int_vector&& p) noexcept{
+    if(this != &p){
+        std::lock(mtx_, p.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(p.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        words = p.words;
+        size = p.size;
+        capacity = p.capacity;
+        bits = p.bits;
+        mask = p.mask;
+
+        p.words = nullptr;
+        p.size = p.capacity = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Reads an element, without bounds checking.
+ *
+ * @note the time complexity is O(1)
+ */
+inline uint64_t packed_int_vector::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return read(index);
+};
+
+/**
+ * @brief Reads an element with bounds checking.
+ *
+ * @param index The position of the element.
+ * @return The value of the element.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+inline uint64_t packed_int_vector::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return read(index);
+};
+
+/**
+ * @brief Writes an element with bounds checking.
+ *
+ * @param index The position of the element.
+ * @param value The new value.
+ * @throws std::out_of_range If the index is out of range.
+ * @throws std::invalid_argument If value does not fit in the element width.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void packed_int_vector::set(const size_t index, uint64_t value){
+    check_value(value);
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    write(index, value);
+};
+
+/**
+ * @brief Appends an element.
+ *
+ * @param value The element to be added.
+ * @throws std::invalid_argument If value does not fit in the element width.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+inline void packed_int_vector::push_back(uint64_t value){
+    check_value(value);
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(words_for(size + 1) > capacity) grow(words_for(size + 1));
+    write(size++, value);
+};
+
+/**
+ * @brief Removes the last element.
+ *
+ * @throws std::out_of_range If the packed vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void packed_int_vector::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    --size;
+};
+
+/**
+ * @brief Changes the number of elements; the added elements are set to value.
+ *
+ * @throws std::invalid_argument If value does not fit in the element width.
+ *
+ * @note the time complexity is O(new_size)
+ */
+inline void packed_int_vector::resize(size_t new_size, uint64_t value){
+    check_value(value);
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    if(words_for(new_size) > capacity) grow(words_for(new_size));
+    for(size_t i = size; i < new_size; ++i) write(i, value);
+    size = new_size;
+};
+
+/**
+ * @brief Grows the storage to hold at least min_size elements.
+ *
+ * @note the time complexity is O(size * bits / 64) if a reallocation happens, O(1) otherwise
+ */
+inline void packed_int_vector::reserve(size_t min_size){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(words_for(min_size) > capacity) grow(words_for(min_size));
+};
+
+/**
+ * @brief Removes every element, keeping the storage.
+ *
+ * @note the time complexity is O(1)
+ */
+inline void packed_int_vector::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    size = 0;
+};
+
+/**
+ * @brief Equality comparison operator: same values in the same order, regardless of the element widths.
+ *
+ * @note the time complexity is O(size)
+ */
+inline bool packed_int_vector::operator==(const packed_int_vector& p) const{
+    if(this == &p) return true;
+
+    std::lock(mtx_, p.mtx_);
+    std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+    std::lock_guard<std::mutex> lock2(p.mtx_, std::adopt_lock);
+
+    if(size != p.size) return false;
+    for(size_t i = 0; i < size; ++i){
+        if(read(i) != p.read(i)) return false;
+    }
+    return true;
+};
+
+inline bool packed_int_vector::operator!=(const packed_int_vector& p) const{
+    return !(*this == p);
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t packed_int_vector::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Returns the width of every element in bits.
+ *
+ * @note the time complexity is O(1)
+ */
+inline unsigned packed_int_vector::get_bits() const{
+    return bits;
+};
+
+/**
+ * @brief Returns the number of bytes used by the elements, i.e. size * bits / 8 rounded up to a whole word.
+ *
+ * @note the time complexity is O(1)
+ */
+inline size_t packed_int_vector::memory_bytes() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return words_for(size) * sizeof(uint64_t);
+};
+
+inline bool packed_int_vector::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Read-only iterator yielding the elements by value.
+ */
+class packed_int_vector::const_iterator{
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = ptrdiff_t;
+        using pointer = const uint64_t*;
+        using reference = uint64_t;
+
+        const_iterator(const packed_int_vector* p, size_t i) : owner(p), index(i){};
+
+        uint64_t operator*() const{
+            return owner->read(index);
+        }
+        const_iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        bool operator==(const const_iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const{
+            return index != other.index;
+        }
+
+    private:
+        const packed_int_vector* owner;
+        size_t index;
+};
+
+inline packed_int_vector::const_iterator packed_int_vector::begin() const{
+    return const_iterator(this, 0);
+};
+
+inline packed_int_vector::const_iterator packed_int_vector::end() const{
+    return const_iterator(this, size);
+};
+
+inline size_t packed_int_vector::words_for(size_t n) const{
+    return (n * bits + word_bits - 1) / word_bits;
+};
+
+/**
+ * @brief Extracts element index from one or two words. The caller must hold mtx_.
+ */
+inline uint64_t packed_int_vector::read(size_t index) const{
+    const size_t offset = index * bits;
+    const size_t w = offset / word_bits;
+    const unsigned shift = offset % word_bits;
+
+    uint64_t value = words[w] >> shift;
+    if(shift + bits > word_bits) value |= words[w + 1] << (word_bits - shift);
+    return value & mask;
+};
+
+/**
+ * @brief Stores element index into one or two words. The caller must hold mtx_.
+ */
+inline void packed_int_vector::write(size_t index, uint64_t value){
+    const size_t offset = index * bits;
+    const size_t w = offset / word_bits;
+    const unsigned shift = offset % word_bits;
+
+    words[w] = (words[w] & ~(mask << shift)) | (value << shift);
+    if(shift + bits > word_bits){
+        const unsigned spill = word_bits - shift;
+        words[w + 1] = (words[w + 1] & ~(mask >> spill)) | (value >> spill);
+    }
+};
+
+inline void packed_int_vector::check_value(uint64_t value) const{
+    if(value & ~mask) throw std::invalid_argument("Value does not fit in the element width");
+};
+
+/**
+ * @brief Reallocates the storage to hold at least min_words words, doubling the capacity when that is larger.
+ * The caller must hold mtx_.
+ */
+inline void packed_int_vector::grow(size_t min_words){
+    size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
+    if(new_capacity < min_words) new_capacity = min_words;
+
+    uint64_t* new_words = alloc.allocate(new_capacity);
+    const size_t used = words_for(size);
+    for(size_t i = 0; i < used; ++i) new_words[i] = words[i];
+    for(size_t i = used; i < new_capacity; ++i) new_words[i] = 0;
+
+    if(words) alloc.deallocate(words, capacity);
+    words = new_words;
+    capacity = new_capacity;
+};
+
+inline void packed_int_vector::clean_up(){
+    if(words) alloc.deallocate(words, capacity);
+    words = nullptr;
+    size = capacity = 0;
+};
+
+inline void packed_int_vector::copy_from(const packed_int_vector& p){
+    bits = p.bits;
+    mask = p.mask;
+
+    const size_t n = p.words_for(p.size);
+    if(n > 0){
+        words = alloc.allocate(n);
+        for(size_t i = 0; i < n; ++i) words[i] = p.words[i];
+    }
+    size = p.size;
+    capacity = n;
+};
+
+#endif
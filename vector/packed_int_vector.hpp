@@ -0,0 +1,77 @@
+#ifndef PACKED_INT_VECTOR_HPP
+#define PACKED_INT_VECTOR_HPP
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file packed_int_vector.hpp
+ * @brief Thread-safe, growable vector of unsigned integers stored with a fixed number of bits each.
+ *
+ * Every element takes exactly bits bits (1 to 64) in a contiguous array of 64 bit words, so e.g. ids below 2^20
+ * take 20 bits instead of 32 or 64. An element straddles at most two words: reading it is two shifts and a mask.
+ * Storing a value that does not fit in bits bits throws instead of truncating silently.
+ *
+ * As in vector, every operation locks the packed vector.
+ *
+ * @author Andrea Maggetto
+ */
+
+class packed_int_vector{
+    public:
+        class const_iterator;
+
+    private:
+        static constexpr size_t word_bits = 64;
+
+        uint64_t* words;
+        size_t size, capacity;
+        unsigned bits;
+        uint64_t mask;
+        allocator<uint64_t> alloc;
+        mutable std::mutex mtx_;
+
+        size_t words_for(size_t n) const;
+        uint64_t read(size_t index) const;
+        void write(size_t index, uint64_t value);
+        void check_value(uint64_t value) const;
+        void grow(size_t min_words);
+        void clean_up();
+        void copy_from(const packed_int_vector& p);
+
+    public:
+        explicit packed_int_vector(unsigned element_bits);
+        packed_int_vector(unsigned element_bits, size_t n, uint64_t value = 0);
+        packed_int_vector(const packed_int_vector& p);
+        packed_int_vector(packed_int_vector&& p);
+        ~packed_int_vector();
+
+        packed_int_vector& operator=(const packed_int_vector& p);
+        packed_int_vector& operator=(packed_int_vector&& p) noexcept;
+
+        uint64_t operator[](const size_t index) const;
+        uint64_t at(const size_t index) const;
+        void set(const size_t index, uint64_t value);
+
+        void push_back(uint64_t value);
+        void pop_back();
+        void resize(size_t new_size, uint64_t value = 0);
+        void reserve(size_t min_size);
+        void clear();
+
+        bool operator==(const packed_int_vector& p) const;
+        bool operator!=(const packed_int_vector& p) const;
+
+        size_t get_size() const;
+        unsigned get_bits() const;
+        size_t memory_bytes() const;
+        bool empty() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
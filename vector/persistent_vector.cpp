@@ -0,0 +1,445 @@
+#ifndef PERSISTENT_VECTOR_CPP
+#define PERSISTENT_VECTOR_CPP
+#include "persistent_vector.hpp"
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    @file persistent_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the persistent_vector class methods
+*/
+
+/**
+ * @brief Opens the vector stored in path, creating an empty one if the file does not exist or is empty.
+ *
+ * Only the header is read, the elements are faulted in lazily on first access.
+ *
+ * @param path The backing file.
+ * @throws std::runtime_error If the file cannot be opened or mapped, or holds another element type.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+persistent_vector<T>::persistent_vector(const std::string& path) : fd(-1), mapping(nullptr), mapping_size(0), data(nullptr), size(0), capacity(0), grown(false){
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if(fd < 0) throw std::runtime_error("Cannot open " + path);
+
+    struct stat st;
+    if(::fstat(fd, &st) != 0){
+        clean_up();
+        throw std::runtime_error("Cannot open " + path);
+    }
+
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    try{
+        if(file_size == 0){
+            grow(1);
+            persistent_header* h = header();
+            std::memcpy(h->magic, persistent_header::magic_value, sizeof(h->magic));
+            h->version = persistent_header::current_version;
+            h->type_size = sizeof(T);
+            h->count = 0;
+            sync_unlocked();
+            return;
+        }
+        if(file_size < sizeof(persistent_header)) throw std::runtime_error("Invalid persistent vector " + path);
+
+        map_file((file_size - sizeof(persistent_header)) / sizeof(T));
+    }catch(...){
+        clean_up();
+        throw;
+    }
+
+    const persistent_header* h = header();
+    if(std::memcmp(h->magic, persistent_header::magic_value, sizeof(h->magic)) != 0 || h->version != persistent_header::current_version ||
+       h->type_size != sizeof(T) || h->count > capacity){
+        clean_up();
+        throw std::runtime_error("Invalid persistent vector " + path);
+    }
+    size = h->count;
+};
+
+/**
+ * @brief Move constructor. The source vector is left closed.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+persistent_vector<T>::persistent_vector(persistent_vector<T>&& pv) noexcept{
+    std::lock_guard<std::mutex> lock(pv.mtx_);
+    fd = pv.fd;
+    mapping = pv.mapping;
+    mapping_size = pv.mapping_size;
+    data = pv.data;
+    size = pv.size;
+    capacity = pv.capacity;
+    grown = pv.grown;
+
+    pv.fd = -1;
+    pv.mapping = nullptr;
+    pv.data = nullptr;
+    pv.mapping_size = pv.size = pv.capacity = 0;
+};
+
+/**
+ * @brief Destructor. Syncs the vector and closes the file.
+ *
+ * @note the time complexity is O(d), where d is the amount of data modified since the last sync
+ */
+template<typename T>
+persistent_vector<T>::~persistent_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Move assignment operator. The current file is synced and closed, the source vector is left closed.
+ *
+ * @note the time complexity is O(d), where d is the amount of data modified since the last sync
+ */
+template<typename T>
+persistent_vector<T>& persistent_vector<T>::operator=(persistent_vector<T>&& pv) noexcept{
+    if(this != &pv){
+        std::lock(mtx_, pv.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(pv.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        fd = pv.fd;
+        mapping = pv.mapping;
+        mapping_size = pv.mapping_size;
+        data = pv.data;
+        size = pv.size;
+        capacity = pv.capacity;
+        grown = pv.grown;
+
+        pv.fd = -1;
+        pv.mapping = nullptr;
+        pv.data = nullptr;
+        pv.mapping_size = pv.size = pv.capacity = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Indexing operator, without bounds checking.
+ *
+ * @note The time complexity is O(1).
+ */
+template<typename T>
+T& persistent_vector<T>::operator[](const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return data[index];
+};
+
+/**
+ * @brief Const indexing operator, without bounds checking.
+ *
+ * @note The time complexity is O(1).
+ */
+template<typename T>
+const T& persistent_vector<T>::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return data[index];
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+T& persistent_vector<T>::at(const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return data[index];
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+const T& persistent_vector<T>::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return data[index];
+};
+
+/**
+ * @brief Accesses the first element.
+ *
+ * @throws std::out_of_range If the vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+T& persistent_vector<T>::front(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return data[0];
+};
+
+/**
+ * @brief Accesses the last element.
+ *
+ * @throws std::out_of_range If the vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+T& persistent_vector<T>::back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    return data[size - 1];
+};
+
+/**
+ * @brief Appends an element, extending the file when it is full.
+ *
+ * @param el The element to be added.
+ * @throws std::runtime_error If the file cannot be extended.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename T>
+void persistent_vector<T>::push_back(const T& el){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == capacity) grow(size + 1);
+    data[size++] = el;
+};
+
+/**
+ * @brief Appends n elements read from first, extending the file at most once.
+ *
+ * @param first Iterator to the first element to append.
+ * @param n The number of elements to append.
+ * @throws std::runtime_error If the file cannot be extended.
+ *
+ * @note the time complexity is O(n)
+ */
+template<typename T>
+template<typename InputIt>
+void persistent_vector<T>::push_back_n(InputIt first, size_t n){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size + n > capacity) grow(size + n);
+    for(size_t i = 0; i < n; ++i, ++first) data[size++] = *first;
+};
+
+/**
+ * @brief Removes the last element. The file keeps its capacity.
+ *
+ * The header keeps the old count until the next sync, so an append before that overwrites a committed element.
+ *
+ * @throws std::out_of_range If the vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+void persistent_vector<T>::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    --size;
+};
+
+/**
+ * @brief Extends the file to hold at least n elements.
+ *
+ * @throws std::runtime_error If the file cannot be extended.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+void persistent_vector<T>::reserve(size_t n){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(n <= capacity) return;
+    if(::ftruncate(fd, static_cast<off_t>(sizeof(persistent_header) + n * sizeof(T))) != 0) throw std::runtime_error("Cannot extend the file");
+    map_file(n);
+    grown = true;
+};
+
+/**
+ * @brief Removes all elements. The file keeps its capacity.
+ *
+ * The header keeps the old count until the next sync, so appends before that overwrite committed elements.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+void persistent_vector<T>::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    size = 0;
+};
+
+/**
+ * @brief Makes the current contents durable and commits the element count.
+ *
+ * The elements are flushed before the header, so a crash at any point leaves the file with either the previous or
+ * the new count, and never exposes appended elements that were not flushed. Elements below the previous count
+ * are overwritten in place and get no such guarantee.
+ *
+ * @throws std::runtime_error If the file cannot be flushed.
+ *
+ * @note the time complexity is O(d), where d is the amount of data modified since the last sync
+ */
+template<typename T>
+void persistent_vector<T>::sync(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    sync_unlocked();
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note The time complexity is O(1)
+ */
+template<typename T>
+size_t persistent_vector<T>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Returns the number of elements the file can hold without being extended.
+ *
+ * @note The time complexity is O(1)
+ */
+template<typename T>
+size_t persistent_vector<T>::get_capacity() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return capacity;
+};
+
+/**
+ * @brief Checks if the vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+bool persistent_vector<T>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Creates an iterator pointing to the first element. It is invalidated when the file is extended.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename persistent_vector<T>::iterator persistent_vector<T>::begin(){
+    return iterator(data);
+};
+
+/**
+ * @brief Creates an iterator pointing to the element after the last one.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename persistent_vector<T>::iterator persistent_vector<T>::end(){
+    return iterator(data + size);
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the first element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename persistent_vector<T>::const_iterator persistent_vector<T>::begin() const{
+    return const_iterator(data);
+};
+
+/**
+ * @brief Creates a constant iterator pointing to the element after the last one.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+typename persistent_vector<T>::const_iterator persistent_vector<T>::end() const{
+    return const_iterator(data + size);
+};
+
+/**
+ * @brief Syncs, unmaps and closes the file, ignoring errors since it runs from the destructor.
+ */
+template<typename T>
+void persistent_vector<T>::clean_up(){
+    if(mapping){
+        try{
+            sync_unlocked();
+        }catch(...){}
+        ::munmap(mapping, mapping_size);
+    }
+    if(fd >= 0) ::close(fd);
+
+    fd = -1;
+    mapping = nullptr;
+    data = nullptr;
+    mapping_size = size = capacity = 0;
+};
+
+/**
+ * @brief Maps (or remaps, possibly moving it) the file as holding new_capacity elements. The file must be that large.
+ */
+template<typename T>
+void persistent_vector<T>::map_file(size_t new_capacity){
+    const size_t new_size = sizeof(persistent_header) + new_capacity * sizeof(T);
+    void* m = mapping ? ::mremap(mapping, mapping_size, new_size, MREMAP_MAYMOVE)
+                      : ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(m == MAP_FAILED) throw std::runtime_error("Cannot map the file");
+
+    mapping = static_cast<char*>(m);
+    mapping_size = new_size;
+    data = reinterpret_cast<T*>(mapping + sizeof(persistent_header));
+    capacity = new_capacity;
+};
+
+/**
+ * @brief Extends the file to at least min_capacity elements, doubling the capacity when that is larger and filling
+ * at least the first page. The caller must hold mtx_.
+ */
+template<typename T>
+void persistent_vector<T>::grow(size_t min_capacity){
+    size_t new_capacity = capacity * 2;
+    const size_t first_page = (4096 - sizeof(persistent_header)) / sizeof(T);
+    if(new_capacity < first_page) new_capacity = first_page;
+    if(new_capacity < min_capacity) new_capacity = min_capacity;
+
+    if(::ftruncate(fd, static_cast<off_t>(sizeof(persistent_header) + new_capacity * sizeof(T))) != 0) throw std::runtime_error("Cannot extend the file");
+    map_file(new_capacity);
+    grown = true;
+};
+
+/**
+ * @brief Flushes the elements, then the file size if it changed, and finally commits the count to the header.
+ * The caller must hold mtx_.
+ */
+template<typename T>
+void persistent_vector<T>::sync_unlocked(){
+    if(::msync(mapping, sizeof(persistent_header) + size * sizeof(T), MS_SYNC) != 0) throw std::runtime_error("Cannot sync the file");
+    if(grown){
+        if(::fdatasync(fd) != 0) throw std::runtime_error("Cannot sync the file");
+        grown = false;
+    }
+
+    if(header()->count == size) return;
+    header()->count = size;
+    if(::msync(mapping, sizeof(persistent_header), MS_SYNC) != 0) throw std::runtime_error("Cannot sync the file");
+};
+
+template<typename T>
+persistent_header* persistent_vector<T>::header() const{
+    return reinterpret_cast<persistent_header*>(mapping);
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef PERSISTENT_VECTOR_HPP
+#define PERSISTENT_VECTOR_HPP
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include "vector.cpp"
+
+/**
+ * @file persistent_vector.hpp
+ * @brief Growable vector whose storage is a memory-mapped file, reopened instantly after a restart.
+ *
+ * The file is a 64 bytes header followed by the elements in place, so reopening maps the file and reads the
+ * header without parsing or copying anything. push_back extends the file with ftruncate and the mapping with
+ * mremap, doubling the capacity like vector. It exposes the same iterator and indexing API as vector.
+ *
+ * sync() is the commit point of the element count: it flushes the elements first and only then writes the new
+ * count to the header, so after a crash the file reopens with the count of the last completed sync, and elements
+ * appended past that count since then are dropped. Elements below the committed count are not protected: writes
+ * through indexing, iterators, front() and back(), and appends that reuse slots freed by pop_back() or clear(),
+ * go straight to the mapped file, so after a crash any of them made since the last sync may already be visible
+ * and the file can reopen mixing synced and unsynced values. Only append-only use (push_back, never writing to
+ * existing elements nor calling pop_back() or clear()) reopens exactly to the state of the last completed sync.
+ *
+ * @note Only trivially copyable element types can be stored.
+ *
+ * @author Andrea Maggetto
+ */
+
+struct persistent_header{
+    static constexpr char magic_value[8] = {'A', 'R', 'V', 'E', 'C', 'P', 'E', 'R'};
+    static constexpr uint32_t current_version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t type_size;
+    uint64_t count;
+    uint8_t reserved[40];
+};
+
+static_assert(sizeof(persistent_header) == 64, "persistent_header must stay 64 bytes");
+
+template<typename T>
+class persistent_vector{
+    static_assert(std::is_trivially_copyable<T>::value, "persistent_vector requires a trivially copyable T");
+
+    int fd;
+    char* mapping;
+    size_t mapping_size;
+    T* data;
+    size_t size, capacity;
+    bool grown;
+    mutable std::mutex mtx_;
+
+    void clean_up();
+    void map_file(size_t new_capacity);
+    void grow(size_t min_capacity);
+    void sync_unlocked();
+    persistent_header* header() const;
+
+    public:
+        using iterator = typename vector<T>::iterator;
+        using const_iterator = typename vector<T>::const_iterator;
+
+        explicit persistent_vector(const std::string& path);
+        persistent_vector(const persistent_vector<T>& pv) = delete;
+        persistent_vector(persistent_vector<T>&& pv) noexcept;
+        ~persistent_vector();
+
+        persistent_vector<T>& operator=(const persistent_vector<T>& pv) = delete;
+        persistent_vector<T>& operator=(persistent_vector<T>&& pv) noexcept;
+
+        T& operator[](const size_t index);
+        const T& operator[](const size_t index) const;
+        T& at(const size_t index);
+        const T& at(const size_t index) const;
+        T& front();
+        T& back();
+
+        void push_back(const T& el);
+        template<typename InputIt>
+        void push_back_n(InputIt first, size_t n);
+        void pop_back();
+        void reserve(size_t n);
+        void clear();
+        void sync();
+
+        size_t get_size() const;
+        size_t get_capacity() const;
+        bool empty() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
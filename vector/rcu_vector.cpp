@@ -0,0 +1,277 @@
+#include "rcu_vector.hpp"
+
+/*
+    @file rcu_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the rcu_vector class methods
+*/
+
+/**
+ * @brief Pinned, immutable view of an rcu_vector snapshot.
+ *
+ * While a guard is alive the snapshot it refers to is never freed, so its elements can be read without
+ * locking. Guards should be short-lived: writers wait for them to be released before reclaiming memory.
+ */
+template<typename T>
+class rcu_vector<T>::read_guard{
+    private:
+        const rcu_vector<T>* owner;
+        unsigned parity;
+        size_t stripe;
+        const snapshot* pinned;
+
+        friend class rcu_vector<T>;
+
+        read_guard(const rcu_vector<T>* o) : owner(o), stripe(reader_stripe()){
+            parity = owner->epoch.load() & 1;
+            owner->readers[parity][stripe].count.fetch_add(1);
+            pinned = owner->current.load();
+        }
+
+    public:
+        read_guard(const read_guard& g) = delete;
+        read_guard(read_guard&& g) noexcept : owner(g.owner), parity(g.parity), stripe(g.stripe), pinned(g.pinned){
+            g.owner = nullptr;
+        }
+        ~read_guard(){
+            if(owner) owner->readers[parity][stripe].count.fetch_sub(1);
+        }
+
+        read_guard& operator=(const read_guard& g) = delete;
+        read_guard& operator=(read_guard&& g) = delete;
+
+        const T& operator[](const size_t index) const{
+            return pinned->data[index];
+        }
+        const T& at(const size_t index) const{
+            if(index >= pinned->size) throw std::out_of_range("Out of range");
+            return pinned->data[index];
+        }
+        size_t get_size() const{
+            return pinned->size;
+        }
+        bool empty() const{
+            return pinned->size == 0;
+        }
+        const_iterator begin() const{
+            return const_iterator(pinned->data.get());
+        }
+        const_iterator end() const{
+            return const_iterator(pinned->data.get() + pinned->size);
+        }
+};
+
+/**
+ * @brief Picks the reader counter stripe of the calling thread, so that concurrent readers rarely share a cache line.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+size_t rcu_vector<T>::reader_stripe(){
+    static thread_local size_t stripe = std::hash<std::thread::id>()(std::this_thread::get_id()) % stripes;
+    return stripe;
+};
+
+/**
+ * @brief Allocates a snapshot holding a copy of size elements and room for capacity.
+ * 
+ * @note the time complexity is O(size)
+ */
+template<typename T>
+typename rcu_vector<T>::snapshot* rcu_vector<T>::make_snapshot(const T* elements, size_t size, size_t capacity){
+    snapshot* fresh = new snapshot{size, std::unique_ptr<T[]>(new T[capacity == 0 ? 1 : capacity])};
+    for(size_t i = 0; i < size; ++i) fresh->data[i] = elements[i];
+    return fresh;
+};
+
+/**
+ * @brief Default constructor. Publishes an empty snapshot.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+rcu_vector<T>::rcu_vector() : current(make_snapshot(nullptr, 0, 0)), epoch(0){};
+
+/**
+ * @brief Constructor that publishes init_size copies of init.
+ * 
+ * @note the time complexity is O(init_size)
+ */
+template<typename T>
+rcu_vector<T>::rcu_vector(const T& init, size_t init_size) : current(nullptr), epoch(0){
+    snapshot* fresh = make_snapshot(nullptr, 0, init_size);
+    for(size_t i = 0; i < init_size; ++i) fresh->data[i] = init;
+    fresh->size = init_size;
+    current.store(fresh);
+};
+
+/**
+ * @brief Constructor that publishes a copy of the elements of v.
+ * 
+ * @note the time complexity is O(v.size)
+ */
+template<typename T>
+rcu_vector<T>::rcu_vector(const vector<T>& v) : current(make_snapshot(nullptr, 0, 0)), epoch(0){
+    assign(v);
+};
+
+/**
+ * @brief Destructor. No reader may hold a guard on the vector anymore.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T>
+rcu_vector<T>::~rcu_vector(){
+    delete current.load();
+};
+
+/**
+ * @brief Pins the current snapshot for wait-free reading.
+ *
+ * @return A guard giving indexed and iterator access to a consistent snapshot.
+ * 
+ * @note the time complexity is O(1), wait-free
+ */
+template<typename T>
+typename rcu_vector<T>::read_guard rcu_vector<T>::read() const{
+    return read_guard(this);
+};
+
+/**
+ * @brief Returns the size of the current snapshot.
+ * 
+ * @note the time complexity is O(1), wait-free
+ */
+template<typename T>
+size_t rcu_vector<T>::get_size() const{
+    return read().get_size();
+};
+
+/**
+ * @brief Returns a copy of the element at index in the current snapshot, with bounds checking.
+ * 
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(1), wait-free
+ */
+template<typename T>
+T rcu_vector<T>::load(const size_t index) const{
+    return read().at(index);
+};
+
+/**
+ * @brief Waits for a full grace period: every read_guard taken before the call has been released afterwards.
+ * The caller must hold writer_mtx.
+ * 
+ * @note the time complexity is bounded by the longest running reader
+ */
+template<typename T>
+void rcu_vector<T>::synchronize(){
+    for(int phase = 0; phase < 2; ++phase){
+        const unsigned old_parity = epoch.fetch_add(1) & 1;
+
+        for(size_t s = 0; s < stripes; ++s){
+            while(readers[old_parity][s].count.load() != 0) std::this_thread::yield();
+        }
+    }
+};
+
+/**
+ * @brief Publishes fresh as the current snapshot and frees the replaced one after a grace period.
+ * The caller must hold writer_mtx.
+ * 
+ * @note the time complexity is bounded by the longest running reader
+ */
+template<typename T>
+void rcu_vector<T>::publish(snapshot* fresh){
+    const snapshot* old = current.exchange(fresh);
+    synchronize();
+    delete old;
+};
+
+/**
+ * @brief Appends an element by publishing a new snapshot.
+ * 
+ * @note the time complexity is O(size), prefer update() for batches
+ */
+template<typename T>
+void rcu_vector<T>::push_back(const T& el){
+    std::lock_guard<std::mutex> lock(writer_mtx);
+    const snapshot* old = current.load();
+
+    snapshot* fresh = make_snapshot(old->data.get(), old->size, old->size + 1);
+    fresh->data[fresh->size++] = el;
+
+    publish(fresh);
+};
+
+/**
+ * @brief Replaces the element at index by publishing a new snapshot.
+ * 
+ * @throws std::out_of_range If the index is out of range.
+ * 
+ * @note the time complexity is O(size), prefer update() for batches
+ */
+template<typename T>
+void rcu_vector<T>::store(const size_t index, const T& el){
+    std::lock_guard<std::mutex> lock(writer_mtx);
+    const snapshot* old = current.load();
+    if(index >= old->size) throw std::out_of_range("Out of range");
+
+    snapshot* fresh = make_snapshot(old->data.get(), old->size, old->size);
+    fresh->data[index] = el;
+
+    publish(fresh);
+};
+
+/**
+ * @brief Publishes a copy of the elements of v, replacing the whole content.
+ * 
+ * @note the time complexity is O(v.size)
+ */
+template<typename T>
+void rcu_vector<T>::assign(const vector<T>& v){
+    snapshot* fresh = make_snapshot(nullptr, 0, v.get_size());
+    for(auto it = v.begin(); it != v.end(); ++it) fresh->data[fresh->size++] = *it;
+
+    std::lock_guard<std::mutex> lock(writer_mtx);
+    publish(fresh);
+};
+
+/**
+ * @brief Applies f to a private copy of the current content and publishes the result as one snapshot.
+ *
+ * Readers keep seeing the previous snapshot while f runs and switch atomically to the result.
+ * 
+ * @param f The function rebuilding or editing the content.
+ * 
+ * @note the time complexity is O(size) plus the cost of f
+ */
+template<typename T>
+void rcu_vector<T>::update(const std::function<void(vector<T>&)>& f){
+    std::lock_guard<std::mutex> lock(writer_mtx);
+
+    vector<T> staging;
+    {
+        read_guard guard = read();
+        for(auto it = guard.begin(); it != guard.end(); ++it) staging.push_back(*it);
+    }
+    f(staging);
+
+    snapshot* fresh = make_snapshot(nullptr, 0, staging.get_size());
+    for(auto it = static_cast<const vector<T>&>(staging).begin(); it != static_cast<const vector<T>&>(staging).end(); ++it){
+        fresh->data[fresh->size++] = *it;
+    }
+
+    publish(fresh);
+};
+
+/**
+ * @brief Publishes an empty snapshot.
+ * 
+ * @note the time complexity is O(1) plus a grace period
+ */
+template<typename T>
+void rcu_vector<T>::clear(){
+    std::lock_guard<std::mutex> lock(writer_mtx);
+    publish(make_snapshot(nullptr, 0, 0));
+};
@@ -0,0 +1,73 @@
+#ifndef RCU_VECTOR_HPP
+#define RCU_VECTOR_HPP
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include "vector.cpp"
+
+/**
+ * @file rcu_vector.hpp
+ * @brief Read-mostly vector with wait-free readers, in the style of read-copy-update (RCU).
+ *
+ * Readers pin the current immutable snapshot through a read_guard and index it without taking any lock:
+ * pinning is an atomic load, one fetch_add on a per-thread counter stripe and an atomic load of the
+ * snapshot pointer. Writers are serialized among themselves, build a new snapshot off to the side and
+ * publish it with a single atomic exchange. The replaced snapshot is freed once a grace period has elapsed,
+ * i.e. once every reader that could still observe it has released its guard.
+ *
+ * Grace periods are tracked with two epoch parities, each with its own striped reader counters: the writer
+ * flips the epoch and waits for the old parity to drain, twice, so readers that loaded a stale epoch are
+ * still accounted for. Every write copies the elements, so batch related changes inside update().
+ * 
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+class rcu_vector{
+    struct snapshot{
+        size_t size;
+        std::unique_ptr<T[]> data;
+    };
+
+    static constexpr size_t stripes = 16;
+
+    struct alignas(64) reader_counter{
+        std::atomic<size_t> count{0};
+    };
+
+    std::atomic<const snapshot*> current;
+    std::atomic<unsigned> epoch;
+    mutable reader_counter readers[2][stripes];
+    std::mutex writer_mtx;
+
+    static size_t reader_stripe();
+    static snapshot* make_snapshot(const T* elements, size_t size, size_t capacity);
+    void publish(snapshot* fresh);
+    void synchronize();
+
+    public:
+        class read_guard;
+        using const_iterator = typename vector<T>::const_iterator;
+
+        rcu_vector();
+        rcu_vector(const T& init, size_t init_size);
+        explicit rcu_vector(const vector<T>& v);
+        rcu_vector(const rcu_vector<T>& v) = delete;
+        ~rcu_vector();
+
+        rcu_vector<T>& operator=(const rcu_vector<T>& v) = delete;
+
+        read_guard read() const;
+        size_t get_size() const;
+        T load(const size_t index) const;
+
+        void push_back(const T& el);
+        void store(const size_t index, const T& el);
+        void assign(const vector<T>& v);
+        void update(const std::function<void(vector<T>&)>& f);
+        void clear();
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef SNAPSHOT_HEADER_HPP
+#define SNAPSHOT_HEADER_HPP
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file snapshot_header.hpp
+ * @brief On-disk header shared by vector::save, vector::load and mapped_vector.
+ *
+ * A snapshot is this 64 bytes header followed by the raw elements, so the payload of a mapped file
+ * stays aligned for any element type with alignment up to 64.
+ *
+ * @author Andrea Maggetto
+ */
+
+struct snapshot_header{
+    static constexpr char magic_value[8] = {'A', 'R', 'V', 'E', 'C', 'S', 'N', 'P'};
+    static constexpr uint32_t current_version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t type_size;
+    uint64_t count;
+    uint64_t checksum;
+    uint8_t reserved[32];
+
+    /**
+     * @brief Builds a header describing count elements of type_size bytes with the given checksum.
+     */
+    static snapshot_header make(uint32_t type_size, uint64_t count, uint64_t checksum){
+        snapshot_header h{};
+        std::memcpy(h.magic, magic_value, sizeof(magic_value));
+        h.version = current_version;
+        h.type_size = type_size;
+        h.count = count;
+        h.checksum = checksum;
+        return h;
+    }
+
+    /**
+     * @brief Checks the magic, version and element size of the header.
+     */
+    bool compatible(uint32_t expected_type_size) const{
+        return std::memcmp(magic, magic_value, sizeof(magic_value)) == 0 &&
+               version == current_version && type_size == expected_type_size;
+    }
+};
+
+static_assert(sizeof(snapshot_header) == 64, "snapshot_header must stay 64 bytes");
+
+/**
+ * @brief Checksum of the snapshot payload.
+ *
+ * Mixes 8 bytes per step instead of hashing byte by byte, so checksumming multi-GB snapshots is bound by
+ * memory bandwidth rather than by the hash.
+ *
+ * @note the time complexity is O(bytes)
+ */
+inline uint64_t snapshot_checksum(const void* payload, size_t bytes){
+    const unsigned char* p = static_cast<const unsigned char*>(payload);
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ bytes;
+    size_t i = 0;
+
+    for(; i + 8 <= bytes; i += 8){
+        uint64_t word;
+        std::memcpy(&word, p + i, 8);
+        h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    for(; i < bytes; ++i) h = (h ^ p[i]) * 0x100000001B3ull;
+
+    return h;
+}
+
+#endif
@@ -0,0 +1,709 @@
+#ifndef SOA_VECTOR_CPP
+#define SOA_VECTOR_CPP
+#include "soa_vector.hpp"
+
+/*
+    @file soa_vector.cpp
+    @brief The current cpp source file contains the actual implementation of the soa_vector class methods
+*/
+
+/**
+ * @brief Proxy standing for element i: it refers to the fields of the element in their columns.
+ *
+ * Assigning a tuple or another reference writes the fields through; converting to value_type copies them out.
+ * swap exchanges the fields of two elements, so that algorithms such as std::sort can reorder a soa_vector.
+ */
+template<typename... Fields>
+class soa_vector<Fields...>::reference{
+    public:
+        explicit reference(Fields&... f) : fields(f...){};
+        reference(const reference& r) = default;
+
+        template<size_t I>
+        field_type<I>& get() const{
+            return std::get<I>(fields);
+        }
+
+        reference& operator=(const value_type& v){
+            fields = v;
+            return *this;
+        }
+        reference& operator=(const reference& r){
+            fields = r.fields;
+            return *this;
+        }
+
+        operator value_type() const{
+            return value_type(fields);
+        }
+
+        bool operator==(const value_type& v) const{
+            return fields == v;
+        }
+        bool operator!=(const value_type& v) const{
+            return !(fields == v);
+        }
+
+        friend void swap(reference a, reference b){
+            value_type temp(a.fields);
+            a.fields = b.fields;
+            b.fields = temp;
+        }
+
+    private:
+        std::tuple<Fields&...> fields;
+};
+
+/**
+ * @brief Read-only proxy standing for element i.
+ */
+template<typename... Fields>
+class soa_vector<Fields...>::const_reference{
+    public:
+        explicit const_reference(const Fields&... f) : fields(f...){};
+
+        template<size_t I>
+        const field_type<I>& get() const{
+            return std::get<I>(fields);
+        }
+
+        operator value_type() const{
+            return value_type(fields);
+        }
+
+        bool operator==(const value_type& v) const{
+            return fields == v;
+        }
+        bool operator!=(const value_type& v) const{
+            return !(fields == v);
+        }
+
+    private:
+        std::tuple<const Fields&...> fields;
+};
+
+/**
+ * @brief Default constructor that initializes an empty soa_vector with a capacity of 10.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+soa_vector<Fields...>::soa_vector() : columns(static_cast<Fields*>(nullptr)...), size(0), capacity(0){
+    grow(10);
+};
+
+/**
+ * @brief Constructor that preallocates every column for initial_capacity elements.
+ *
+ * @param initial_capacity The number of elements that fit before the first reallocation.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+soa_vector<Fields...>::soa_vector(size_t initial_capacity) : columns(static_cast<Fields*>(nullptr)...), size(0), capacity(0){
+    grow(initial_capacity);
+};
+
+/**
+ * @brief Copy constructor.
+ *
+ * @param v The soa_vector to be copied.
+ *
+ * @note the time complexity is O(v.size)
+ */
+template<typename... Fields>
+soa_vector<Fields...>::soa_vector(const soa_vector& v) : columns(static_cast<Fields*>(nullptr)...), size(0), capacity(0){
+    std::lock_guard<std::mutex> lock(v.mtx_);
+    copy_from(v);
+};
+
+/**
+ * @brief Move constructor. The source is left empty, with no storage.
+ *
+ * @param v The soa_vector to be moved.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+soa_vector<Fields...>::soa_vector(soa_vector&& v){
+    std::lock_guard<std::mutex> lock(v.mtx_);
+    columns = v.columns;
+    size = v.size;
+    capacity = v.capacity;
+    v.columns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+    v.size = v.capacity = 0;
+};
+
+/**
+ * @brief Destructor that destroys the elements and frees every column.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename... Fields>
+soa_vector<Fields...>::~soa_vector(){
+    clean_up();
+};
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param v The soa_vector to be copied.
+ * @return Reference to the modified soa_vector.
+ *
+ * @note the time complexity is O(size + v.size)
+ */
+template<typename... Fields>
+soa_vector<Fields...>& soa_vector<Fields...>::operator=(const soa_vector& v){
+    if(this != &v){
+        std::lock(mtx_, v.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(v.mtx_, std::adopt_lock);
+
+        clean_up();
+        copy_from(v);
+    }
+    return *this;
+};
+
+/**
+ * @brief Move assignment operator. The source is left empty, with no storage.
+ *
+ * @param v The soa_vector to be moved.
+ * @return Reference to the modified soa_vector.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename... Fields>
+soa_vector<Fields...>& soa_vector<Fields...>::operator=(soa_vector&& v) noexcept{
+    if(this != &v){
+        std::lock(mtx_, v.mtx_);
+        std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
+        std::lock_guard<std::mutex> lock2(v.mtx_, std::adopt_lock);
+
+        clean_up();
+
+        columns = v.columns;
+        size = v.size;
+        capacity = v.capacity;
+
+        v.columns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+        v.size = v.capacity = 0;
+    }
+    return *this;
+};
+
+/**
+ * @brief Appends an element given field by field.
+ *
+ * @param values The fields of the new element, in declaration order.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::push_back(const Fields&... values){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == capacity) grow(size + 1);
+    construct_back(std::index_sequence_for<Fields...>(), values...);
+    ++size;
+};
+
+/**
+ * @brief Appends an element given as a tuple.
+ *
+ * @param element The fields of the new element.
+ *
+ * @note the time complexity is O(1) amortized
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::push_back(const value_type& element){
+    std::apply([this](const Fields&... values){ push_back(values...); }, element);
+};
+
+/**
+ * @brief Removes the last element.
+ *
+ * @throws std::out_of_range If the soa_vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    destroy_back();
+};
+
+/**
+ * @brief Grows every column to hold at least min_capacity elements.
+ *
+ * @param min_capacity The requested capacity.
+ *
+ * @note the time complexity is O(size) if a reallocation happens, O(1) otherwise
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::reserve(size_t min_capacity){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(min_capacity > capacity) grow(min_capacity);
+};
+
+/**
+ * @brief Destroys every element, keeping the storage.
+ *
+ * @note the time complexity is O(size)
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::clear(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    while(size > 0) destroy_back();
+};
+
+/**
+ * @brief Indexing operator, without bounds checking.
+ *
+ * @param index The position of the element.
+ * @return A proxy referring to the fields of the element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return make_reference(index, std::index_sequence_for<Fields...>());
+};
+
+/**
+ * @brief Const indexing operator, without bounds checking.
+ *
+ * @param index The position of the element.
+ * @return A read-only proxy referring to the fields of the element.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::operator[](const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return make_reference(index, std::index_sequence_for<Fields...>());
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @param index The position of the element.
+ * @return A proxy referring to the fields of the element.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return make_reference(index, std::index_sequence_for<Fields...>());
+};
+
+/**
+ * @brief Accesses the element at the specified index with bounds checking.
+ *
+ * @param index The position of the element.
+ * @return A read-only proxy referring to the fields of the element.
+ * @throws std::out_of_range If the index is out of range.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::at(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(index >= size) throw std::out_of_range("Out of range");
+    return make_reference(index, std::index_sequence_for<Fields...>());
+};
+
+/**
+ * @brief Accesses field I of the element at index, without bounds checking.
+ *
+ * @param index The position of the element.
+ * @return Reference to the field.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+template<size_t I>
+typename soa_vector<Fields...>::template field_type<I>& soa_vector<Fields...>::get(const size_t index){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return std::get<I>(columns)[index];
+};
+
+/**
+ * @brief Accesses field I of the element at index, without bounds checking.
+ *
+ * @param index The position of the element.
+ * @return Const reference to the field.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+template<size_t I>
+const typename soa_vector<Fields...>::template field_type<I>& soa_vector<Fields...>::get(const size_t index) const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return std::get<I>(columns)[index];
+};
+
+/**
+ * @brief Returns the contiguous array of field I of every element.
+ *
+ * The span is invalidated by any reallocation, i.e. by push_back beyond the capacity and by reserve.
+ *
+ * @return A span of get_size() fields.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+template<size_t I>
+std::span<typename soa_vector<Fields...>::template field_type<I>> soa_vector<Fields...>::column(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    return std::span<field_type<I>>(std::get<I>(columns), size);
+};
+
+/**
+ * @brief Returns the contiguous, read-only array of field I of every element.
+ *
+ * @return A span of get_size() fields.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+template<size_t I>
+std::span<const typename soa_vector<Fields...>::template field_type<I>> soa_vector<Fields...>::column() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return std::span<const field_type<I>>(std::get<I>(columns), size);
+};
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+size_t soa_vector<Fields...>::get_size() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size;
+};
+
+/**
+ * @brief Returns the number of elements every column can hold before reallocating.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+size_t soa_vector<Fields...>::get_capacity() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return capacity;
+};
+
+/**
+ * @brief Checks if the soa_vector is empty.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename... Fields>
+bool soa_vector<Fields...>::empty() const{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return size == 0;
+};
+
+/**
+ * @brief Random access iterator yielding proxy references.
+ */
+template<typename... Fields>
+class soa_vector<Fields...>::iterator{
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename soa_vector<Fields...>::value_type;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = typename soa_vector<Fields...>::reference;
+
+        iterator() : owner(nullptr), index(0){};
+        iterator(soa_vector* v, size_t i) : owner(v), index(i){};
+
+        reference operator*() const{
+            return owner->make_reference(index, std::index_sequence_for<Fields...>());
+        }
+        reference operator[](difference_type n) const{
+            return owner->make_reference(index + n, std::index_sequence_for<Fields...>());
+        }
+
+        iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        iterator operator++(int){
+            iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        iterator& operator--(){
+            --index;
+            return *this;
+        }
+        iterator operator--(int){
+            iterator temp = *this;
+            --index;
+            return temp;
+        }
+        iterator& operator+=(difference_type n){
+            index += n;
+            return *this;
+        }
+        iterator& operator-=(difference_type n){
+            index -= n;
+            return *this;
+        }
+        iterator operator+(difference_type n) const{
+            return iterator(owner, index + n);
+        }
+        iterator operator-(difference_type n) const{
+            return iterator(owner, index - n);
+        }
+        friend iterator operator+(difference_type n, const iterator& it){
+            return it + n;
+        }
+        difference_type operator-(const iterator& other) const{
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const iterator& other) const{
+            return index != other.index;
+        }
+        bool operator<(const iterator& other) const{
+            return index < other.index;
+        }
+        bool operator>(const iterator& other) const{
+            return index > other.index;
+        }
+        bool operator<=(const iterator& other) const{
+            return index <= other.index;
+        }
+        bool operator>=(const iterator& other) const{
+            return index >= other.index;
+        }
+
+    private:
+        soa_vector* owner;
+        size_t index;
+
+        friend class const_iterator;
+};
+
+/**
+ * @brief Random access iterator yielding read-only proxy references.
+ */
+template<typename... Fields>
+class soa_vector<Fields...>::const_iterator{
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename soa_vector<Fields...>::value_type;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = typename soa_vector<Fields...>::const_reference;
+
+        const_iterator() : owner(nullptr), index(0){};
+        const_iterator(const soa_vector* v, size_t i) : owner(v), index(i){};
+        const_iterator(const iterator& it) : owner(it.owner), index(it.index){};
+
+        reference operator*() const{
+            return owner->make_reference(index, std::index_sequence_for<Fields...>());
+        }
+        reference operator[](difference_type n) const{
+            return owner->make_reference(index + n, std::index_sequence_for<Fields...>());
+        }
+
+        const_iterator& operator++(){
+            ++index;
+            return *this;
+        }
+        const_iterator operator++(int){
+            const_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+        const_iterator& operator--(){
+            --index;
+            return *this;
+        }
+        const_iterator operator--(int){
+            const_iterator temp = *this;
+            --index;
+            return temp;
+        }
+        const_iterator& operator+=(difference_type n){
+            index += n;
+            return *this;
+        }
+        const_iterator& operator-=(difference_type n){
+            index -= n;
+            return *this;
+        }
+        const_iterator operator+(difference_type n) const{
+            return const_iterator(owner, index + n);
+        }
+        const_iterator operator-(difference_type n) const{
+            return const_iterator(owner, index - n);
+        }
+        friend const_iterator operator+(difference_type n, const const_iterator& it){
+            return it + n;
+        }
+        difference_type operator-(const const_iterator& other) const{
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const const_iterator& other) const{
+            return index == other.index;
+        }
+        bool operator!=(const const_iterator& other) const{
+            return index != other.index;
+        }
+        bool operator<(const const_iterator& other) const{
+            return index < other.index;
+        }
+        bool operator>(const const_iterator& other) const{
+            return index > other.index;
+        }
+        bool operator<=(const const_iterator& other) const{
+            return index <= other.index;
+        }
+        bool operator>=(const const_iterator& other) const{
+            return index >= other.index;
+        }
+
+    private:
+        const soa_vector* owner;
+        size_t index;
+};
+
+template<typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::begin(){
+    return iterator(this, 0);
+};
+
+template<typename... Fields>
+typename soa_vector<Fields...>::iterator soa_vector<Fields...>::end(){
+    return iterator(this, size);
+};
+
+template<typename... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::begin() const{
+    return const_iterator(this, 0);
+};
+
+template<typename... Fields>
+typename soa_vector<Fields...>::const_iterator soa_vector<Fields...>::end() const{
+    return const_iterator(this, size);
+};
+
+/**
+ * @brief Calls f with std::integral_constant<size_t, I> for every column I.
+ */
+template<typename... Fields>
+template<typename F>
+void soa_vector<Fields...>::for_each_column(F&& f){
+    for_each_column(f, std::index_sequence_for<Fields...>());
+};
+
+template<typename... Fields>
+template<typename F, size_t... I>
+void soa_vector<Fields...>::for_each_column(F& f, std::index_sequence<I...>){
+    (f(std::integral_constant<size_t, I>()), ...);
+};
+
+/**
+ * @brief Constructs the fields of a new last element, one per column. The caller must hold mtx_ and ensure
+ * size < capacity.
+ */
+template<typename... Fields>
+template<size_t... I>
+void soa_vector<Fields...>::construct_back(std::index_sequence<I...>, const Fields&... values){
+    (new (std::get<I>(columns) + size) Fields(values), ...);
+};
+
+template<typename... Fields>
+template<size_t... I>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::make_reference(size_t index, std::index_sequence<I...>){
+    return reference(std::get<I>(columns)[index]...);
+};
+
+template<typename... Fields>
+template<size_t... I>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::make_reference(size_t index, std::index_sequence<I...>) const{
+    return const_reference(std::get<I>(columns)[index]...);
+};
+
+/**
+ * @brief Reallocates every column to hold at least min_capacity elements, doubling the capacity when that is
+ * larger. The caller must hold mtx_.
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::grow(size_t min_capacity){
+    size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
+    if(new_capacity < min_capacity) new_capacity = min_capacity;
+
+    for_each_column([&](auto column){
+        constexpr size_t I = decltype(column)::value;
+        using field = field_type<I>;
+
+        field* old_data = std::get<I>(columns);
+        field* new_data = std::get<I>(allocs).allocate(new_capacity);
+
+        for(size_t i = 0; i < size; ++i){
+            new (new_data + i) field(std::move(old_data[i]));
+            old_data[i].~field();
+        }
+        if(old_data) std::get<I>(allocs).deallocate(old_data, capacity);
+
+        std::get<I>(columns) = new_data;
+    });
+
+    capacity = new_capacity;
+};
+
+/**
+ * @brief Destroys the fields of the last element. The caller must hold mtx_ and ensure size > 0.
+ */
+template<typename... Fields>
+void soa_vector<Fields...>::destroy_back(){
+    --size;
+    for_each_column([&](auto column){
+        using field = field_type<decltype(column)::value>;
+        std::get<decltype(column)::value>(columns)[size].~field();
+    });
+};
+
+template<typename... Fields>
+void soa_vector<Fields...>::clean_up(){
+    while(size > 0) destroy_back();
+
+    for_each_column([&](auto column){
+        constexpr size_t I = decltype(column)::value;
+        if(std::get<I>(columns)) std::get<I>(allocs).deallocate(std::get<I>(columns), capacity);
+        std::get<I>(columns) = nullptr;
+    });
+
+    capacity = 0;
+};
+
+template<typename... Fields>
+void soa_vector<Fields...>::copy_from(const soa_vector& v){
+    grow(v.capacity);
+
+    for_each_column([&](auto column){
+        constexpr size_t I = decltype(column)::value;
+        using field = field_type<I>;
+        for(size_t i = 0; i < v.size; ++i) new (std::get<I>(columns) + i) field(std::get<I>(v.columns)[i]);
+    });
+
+    size = v.size;
+};
+
+#endif
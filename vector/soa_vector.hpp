@@ -0,0 +1,106 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "../allocators/allocator.hpp"
+
+/**
+ * @file soa_vector.hpp
+ * @brief Thread-safe structure-of-arrays vector for aggregate elements.
+ *
+ * An element is a tuple of fields, but every field is stored in its own contiguous array, so a pass that reads one
+ * field only streams that field through the cache, and column<I>() exposes it as a std::span that the compiler can
+ * vectorize. Element i is still addressable as a whole through a proxy reference, which yields the fields with
+ * get<I>() and converts to and from std::tuple<Fields...>. All the columns grow together, by doubling, and are
+ * allocated through allocator.
+ *
+ * As in vector, push_back, pop_back and the accessors lock the container; the spans and proxies they return are
+ * not protected once the call returns.
+ *
+ * @tparam Fields The types of the fields of an element.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename... Fields>
+class soa_vector{
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+    public:
+        template<size_t I>
+        using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+        using value_type = std::tuple<Fields...>;
+
+        class reference;
+        class const_reference;
+        class iterator;
+        class const_iterator;
+
+    private:
+        std::tuple<Fields*...> columns;
+        std::tuple<allocator<Fields>...> allocs;
+        size_t size, capacity;
+        mutable std::mutex mtx_;
+
+        template<typename F>
+        void for_each_column(F&& f);
+        template<typename F, size_t... I>
+        void for_each_column(F& f, std::index_sequence<I...>);
+        template<size_t... I>
+        void construct_back(std::index_sequence<I...>, const Fields&... values);
+        template<size_t... I>
+        reference make_reference(size_t index, std::index_sequence<I...>);
+        template<size_t... I>
+        const_reference make_reference(size_t index, std::index_sequence<I...>) const;
+
+        void grow(size_t min_capacity);
+        void destroy_back();
+        void clean_up();
+        void copy_from(const soa_vector& v);
+
+    public:
+        soa_vector();
+        explicit soa_vector(size_t initial_capacity);
+        soa_vector(const soa_vector& v);
+        soa_vector(soa_vector&& v);
+        ~soa_vector();
+
+        soa_vector& operator=(const soa_vector& v);
+        soa_vector& operator=(soa_vector&& v) noexcept;
+
+        void push_back(const Fields&... values);
+        void push_back(const value_type& element);
+        void pop_back();
+        void reserve(size_t min_capacity);
+        void clear();
+
+        reference operator[](const size_t index);
+        const_reference operator[](const size_t index) const;
+        reference at(const size_t index);
+        const_reference at(const size_t index) const;
+        template<size_t I>
+        field_type<I>& get(const size_t index);
+        template<size_t I>
+        const field_type<I>& get(const size_t index) const;
+
+        template<size_t I>
+        std::span<field_type<I>> column();
+        template<size_t I>
+        std::span<const field_type<I>> column() const;
+
+        size_t get_size() const;
+        size_t get_capacity() const;
+        bool empty() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+};
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef SORTED_SEARCH_HPP
+#define SORTED_SEARCH_HPP
+#include <cstddef>
+
+/**
+ * @file sorted_search.hpp
+ * @brief Branchless binary search over a sorted contiguous range, shared by flat_set and flat_map.
+ *
+ * The loop always runs ceil(log2(n)) iterations and selects the next half with a conditional move instead
+ * of a data dependent branch, so a lookup never pays a branch misprediction. The probe of the next
+ * iteration is prefetched because its address only depends on the two candidate halves.
+ *
+ * @author Andrea Maggetto
+ */
+
+/**
+ * @brief Returns a pointer to the first element of [first, first + n) for which less(element, key) is false.
+ *
+ * @param project Maps an element to the value compared with key.
+ * 
+ * @note the time complexity is O(log n)
+ */
+template<typename T, typename Key, typename Compare, typename Projection>
+const T* branchless_lower_bound(const T* first, size_t n, const Key& key, Compare& less, Projection project){
+    if(n == 0) return first;
+
+    const T* base = first;
+    while(n > 1){
+        const size_t half = n / 2;
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base = less(project(base[half]), key) ? base + half : base;
+        n -= half;
+    }
+
+    return base + (less(project(*base), key) ? 1 : 0);
+}
+
+#endif
@@ -1,3 +1,5 @@
+#ifndef VECTOR_CPP
+#define VECTOR_CPP
 #include "vector.hpp"
 
 /*
@@ -11,8 +13,18 @@
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-vector<T>::vector() : size(0), capacity(10), data(new T[capacity]){};
+template<typename T, typename Alloc>
+vector<T, Alloc>::vector() : size(0), capacity(10), data(allocate_storage(capacity)){};
+
+/**
+ * @brief Constructor for an empty vector whose storage comes from the given allocator, e.g. a configured huge_page_allocator.
+ *
+ * @param a The allocator.
+ *
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+vector<T, Alloc>::vector(const Alloc& a) : alloc(a), size(0), capacity(10), data(allocate_storage(capacity)){};
 
 /**
  * @brief Constructor for the vector class that initializes with a given element and size.
@@ -22,8 +34,8 @@ vector<T>::vector() : size(0), capacity(10), data(new T[capacity]){};
  * 
  * @note the time complexity is O(init_size)
  */
-template<typename T>
-vector<T>::vector(const T& init, size_t init_size) : size(init_size), capacity(init_size * 2), data(new T[init_size * 2]){
+template<typename T, typename Alloc>
+vector<T, Alloc>::vector(const T& init, size_t init_size) : size(init_size), capacity(init_size * 2), data(allocate_storage(init_size * 2)){
     for(size_t i = 0; i < init_size; ++i) data[i] = init;
 };
 
@@ -36,11 +48,12 @@ vector<T>::vector(const T& init, size_t init_size) : size(init_size), capacity(i
  * 
  * @note the time complexity is O(v.size)
  */
-template<typename T>
-vector<T>::vector(const vector<T>& v){
+template<typename T, typename Alloc>
+vector<T, Alloc>::vector(const vector<T, Alloc>& v){
     std::lock(mtx_,v.mtx_);
     std::lock_guard<std::mutex> lock1(mtx_, std::adopt_lock);
     std::lock_guard<std::mutex> lock2(v.mtx_, std::adopt_lock);
+    alloc = v.alloc;
     copy_from(v);
 };
 
@@ -54,9 +67,10 @@ vector<T>::vector(const vector<T>& v){
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-vector<T>::vector(vector<T>&& v){
+template<typename T, typename Alloc>
+vector<T, Alloc>::vector(vector<T, Alloc>&& v){
     std::unique_lock<std::mutex> lock(v.mtx_); //lock the source vector 
+    alloc = v.alloc;
     data = v.data;
     size = v.size;
     capacity = v.capacity;
@@ -71,8 +85,8 @@ vector<T>::vector(vector<T>&& v){
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-vector<T>::~vector(){
+template<typename T, typename Alloc>
+vector<T, Alloc>::~vector(){
     clean_up();
 };
 
@@ -83,8 +97,8 @@ vector<T>::~vector(){
  * 
  *  @note The time complexity is O(1)
  */
-template<typename T>
-size_t vector<T>::get_size() const{
+template<typename T, typename Alloc>
+size_t vector<T, Alloc>::get_size() const{
     std::lock_guard<std::mutex> lock(mtx_);
     return size;
 };
@@ -98,22 +112,57 @@ size_t vector<T>::get_size() const{
  * 
  * @note the time complexity is O(1) amortized
  */
-template<typename T>
-void vector<T>::push_back(const T& el){
+template<typename T, typename Alloc>
+void vector<T, Alloc>::push_back(const T& el){
     std::lock_guard<std::mutex> lock(mtx_);
-    if(size == capacity){
-        size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
-        
-        T* data_restore = new T[new_capacity];
+    push_back_unlocked(el);
+};
 
-        for(size_t i = 0; i < size; ++i) data_restore[i] = std::move(data[i]);
+/**
+ * @brief Appends n elements read from first under a single lock acquisition.
+ *
+ * The storage is grown at most once, so the cost of locking and reallocation is paid once for the whole range.
+ *
+ * @param first Iterator to the first element to append.
+ * @param n The number of elements to append.
+ * 
+ * @note the time complexity is O(n)
+ */
+template<typename T, typename Alloc>
+template<typename InputIt>
+void vector<T, Alloc>::push_back_n(InputIt first, size_t n){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size + n > capacity) grow(size + n);
+    for(size_t i = 0; i < n; ++i, ++first) data[size++] = *first;
+};
 
-        delete[] data;
-        data = data_restore;
-        capacity = new_capacity;
-    }
-    data[size] = el;
-    ++size;
+/**
+ * @brief Locks the vector once and returns a handle exposing unlocked operations.
+ *
+ * The lock is held until the handle is destroyed, so a sequence of operations pays a single lock round-trip.
+ * Using the vector directly from the same thread while the handle is alive deadlocks.
+ *
+ * @return The batch handle.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+typename vector<T, Alloc>::batch vector<T, Alloc>::lock_batch(){
+    return batch(*this);
+};
+
+/**
+ * @brief Removes the last element of the vector.
+ *
+ * @throws std::out_of_range If the vector is empty.
+ * 
+ * @note the time complexity is O(1)
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::pop_back(){
+    std::lock_guard<std::mutex> lock(mtx_);
+    if(size == 0) throw std::out_of_range("Out of range!");
+    data[--size] = T();
 };
 
 /**
@@ -126,8 +175,8 @@ void vector<T>::push_back(const T& el){
  * 
  * @note the time complexity of the function is O(v.size)
  */
-template<typename T>
-vector<T>& vector<T>::operator=(const vector<T>& v){
+template<typename T, typename Alloc>
+vector<T, Alloc>& vector<T, Alloc>::operator=(const vector<T, Alloc>& v){
     if(this != &v){
         std::lock_guard<std::mutex> lock(v.mtx_);
 
@@ -147,13 +196,14 @@ vector<T>& vector<T>::operator=(const vector<T>& v){
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-vector<T>& vector<T>::operator=(vector<T>&& v) noexcept{
+template<typename T, typename Alloc>
+vector<T, Alloc>& vector<T, Alloc>::operator=(vector<T, Alloc>&& v) noexcept{
     if(this != &v){
         std::lock_guard<std::mutex> lock(v.mtx_);
 
         clean_up();
 
+        alloc = v.alloc;
         data = v.data;
         size = v.size;
         capacity = v.capacity;
@@ -173,8 +223,8 @@ vector<T>& vector<T>::operator=(vector<T>&& v) noexcept{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-T& vector<T>::at(const size_t index) const{
+template<typename T, typename Alloc>
+T& vector<T, Alloc>::at(const size_t index) const{
     std::lock_guard<std::mutex> lock(mtx_);
 
     if(index >= size) throw std::out_of_range("Out of range");
@@ -188,8 +238,8 @@ T& vector<T>::at(const size_t index) const{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-bool vector<T>::empty() const{
+template<typename T, typename Alloc>
+bool vector<T, Alloc>::empty() const{
     return size == 0;
 };
 
@@ -201,8 +251,8 @@ bool vector<T>::empty() const{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-T& vector<T>::back() const{
+template<typename T, typename Alloc>
+T& vector<T, Alloc>::back() const{
     std::lock_guard<std::mutex> lock(mtx_);
     if(size == 0) throw std::out_of_range("Out of range!");
     return data[size - 1];
@@ -216,8 +266,8 @@ T& vector<T>::back() const{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-T& vector<T>::front() const{
+template<typename T, typename Alloc>
+T& vector<T, Alloc>::front() const{
     std::lock_guard<std::mutex> lock(mtx_);
     if(size == 0) throw std::out_of_range("Out of range!");
     return data[0];
@@ -233,8 +283,8 @@ T& vector<T>::front() const{
  * 
  * @note the time complexity is O(v.size)
  */
-template<typename T>
-bool vector<T>::operator==(const vector<T>& v) const{
+template<typename T, typename Alloc>
+bool vector<T, Alloc>::operator==(const vector<T, Alloc>& v) const{
     if(this != &v){
         std::lock_guard<std::mutex> lock(v.mtx_);
         if(size != v.size) return false;
@@ -255,8 +305,8 @@ bool vector<T>::operator==(const vector<T>& v) const{
  * 
  * @note the time complexity is O(v.size)
  */
-template<typename T>
-bool vector<T>::operator!=(const vector<T>& v) const{
+template<typename T, typename Alloc>
+bool vector<T, Alloc>::operator!=(const vector<T, Alloc>& v) const{
     return !(*this == v);
 };
 
@@ -270,8 +320,8 @@ bool vector<T>::operator!=(const vector<T>& v) const{
  * 
  * @note The time complexity is O(1).
  */
-template<typename T>
-T& vector<T>::operator[](const size_t index){
+template<typename T, typename Alloc>
+T& vector<T, Alloc>::operator[](const size_t index){
     std::lock_guard<std::mutex> lock(mtx_);
     return data[index];
 };
@@ -286,8 +336,8 @@ T& vector<T>::operator[](const size_t index){
  * 
  * @note The time complexity is O(1).
  */
-template<typename T>
-const T& vector<T>::operator[](const size_t index) const{
+template<typename T, typename Alloc>
+const T& vector<T, Alloc>::operator[](const size_t index) const{
     std::lock_guard<std::mutex> lock(mtx_);
     return data[index];
 };
@@ -299,13 +349,97 @@ const T& vector<T>::operator[](const size_t index) const{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-void vector<T>::clear(){
+template<typename T, typename Alloc>
+void vector<T, Alloc>::clear(){
     clean_up();
 
     capacity = 10;
 
-    data = new T[capacity];
+    data = allocate_storage(capacity);
+};
+
+/**
+ * @brief Writes the vector to a binary snapshot file.
+ *
+ * The file holds a snapshot_header (element size, count, checksum) followed by the raw elements, written
+ * with a single bulk write. The snapshot is written to path + ".tmp" and renamed over path once complete, so
+ * a failed save leaves the previous snapshot intact. Only available for trivially copyable element types.
+ *
+ * @param path The file to create or overwrite.
+ * @throws std::runtime_error If the file cannot be written.
+ * 
+ * @note the time complexity is O(size)
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::save(const std::string& path) const{
+    static_assert(std::is_trivially_copyable<T>::value, "save requires a trivially copyable T");
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    const std::string tmp_path = path + ".tmp";
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if(!out) throw std::runtime_error("Cannot open " + tmp_path);
+
+    const size_t bytes = size * sizeof(T);
+    snapshot_header header = snapshot_header::make(sizeof(T), size, snapshot_checksum(data, bytes));
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(data), bytes);
+    out.close();
+    if(!out){
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error("Cannot write " + path);
+    }
+    if(std::rename(tmp_path.c_str(), path.c_str()) != 0){
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error("Cannot replace " + path);
+    }
+};
+
+/**
+ * @brief Replaces the contents of the vector with a snapshot written by save.
+ *
+ * The elements are read with a single bulk read straight into the new buffer, so the peak memory is the
+ * snapshot size plus the old buffer. The current contents are kept if loading fails.
+ *
+ * @param path The snapshot file.
+ * @throws std::runtime_error If the file cannot be read, was written for another element size or is corrupted.
+ * 
+ * @note the time complexity is O(n), where n is the number of elements in the snapshot
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::load(const std::string& path){
+    static_assert(std::is_trivially_copyable<T>::value, "load requires a trivially copyable T");
+
+    std::ifstream in(path, std::ios::binary);
+    if(!in) throw std::runtime_error("Cannot open " + path);
+
+    in.seekg(0, std::ios::end);
+    const std::streamoff file_size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    if(!in || file_size < static_cast<std::streamoff>(sizeof(snapshot_header))) throw std::runtime_error("Invalid snapshot " + path);
+
+    snapshot_header header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if(!in || !header.compatible(sizeof(T))) throw std::runtime_error("Invalid snapshot " + path);
+
+    // checked before allocating, so a corrupted count cannot cause a huge allocation or an overflowing read size
+    const uint64_t max_count = (static_cast<uint64_t>(file_size) - sizeof(snapshot_header)) / sizeof(T);
+    if(header.count > max_count) throw std::runtime_error("Corrupted snapshot " + path);
+
+    const size_t new_capacity = header.count < 10 ? 10 : header.count;
+    T* loaded = allocate_storage(new_capacity);
+
+    in.read(reinterpret_cast<char*>(loaded), header.count * sizeof(T));
+    if(!in || snapshot_checksum(loaded, header.count * sizeof(T)) != header.checksum){
+        free_storage(loaded, new_capacity);
+        throw std::runtime_error("Corrupted snapshot " + path);
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    free_storage(data, capacity);
+    data = loaded;
+    size = header.count;
+    capacity = new_capacity;
 };
 
 /**
@@ -313,8 +447,8 @@ void vector<T>::clear(){
  *
  * This class provides a way to iterate over the elements of the vector.
  */
-template<typename T>
-class vector<T>::iterator{
+template<typename T, typename Alloc>
+class vector<T, Alloc>::iterator{
     public:
         using iterator_category = std::forward_iterator_tag;
         using value_type = T;
@@ -354,8 +488,8 @@ class vector<T>::iterator{
  *
  * This class provides a way to iterate over the elements of the vector while preventing modification of the elements.
  */
-template<typename T>
-class vector<T>::const_iterator{
+template<typename T, typename Alloc>
+class vector<T, Alloc>::const_iterator{
     public:
         using iterator_type = std::forward_iterator_tag;
         using value_type = const T;
@@ -392,6 +526,59 @@ class vector<T>::const_iterator{
         pointer current;
 };
 
+/**
+ * @brief Scoped batch handle for the vector.
+ *
+ * Holds the vector lock for its whole lifetime and exposes the common operations without any further
+ * locking, which amortizes the lock round-trips of long sequences of operations to a single one. Constructed
+ * with std::defer_lock it takes no lock at all, for an owner that already serializes every access to the vector.
+ */
+template<typename T, typename Alloc>
+class vector<T, Alloc>::batch{
+    public:
+        explicit batch(vector<T, Alloc>& v) : owner(&v), lock(v.mtx_){};
+        batch(vector<T, Alloc>& v, std::defer_lock_t) : owner(&v), lock(v.mtx_, std::defer_lock){};
+
+        void push_back(const T& el){
+            owner->push_back_unlocked(el);
+        }
+        void pop_back(){
+            if(owner->size == 0) throw std::out_of_range("Out of range!");
+            owner->data[--owner->size] = T();
+        }
+        void clear(){
+            owner->clean_up();
+            owner->capacity = 10;
+            owner->data = owner->allocate_storage(owner->capacity);
+        }
+        T& operator[](const size_t index){
+            return owner->data[index];
+        }
+        const T& operator[](const size_t index) const{
+            return owner->data[index];
+        }
+        T& at(const size_t index){
+            if(index >= owner->size) throw std::out_of_range("Out of range");
+            return owner->data[index];
+        }
+        size_t get_size() const{
+            return owner->size;
+        }
+        bool empty() const{
+            return owner->size == 0;
+        }
+        iterator begin(){
+            return iterator(owner->data);
+        }
+        iterator end(){
+            return iterator(owner->data + owner->size);
+        }
+
+    private:
+        vector<T, Alloc>* owner;
+        std::unique_lock<std::mutex> lock;
+};
+
 /**
  * @brief Creates an iterator pointing to the beginning of the vector.
  *
@@ -399,8 +586,8 @@ class vector<T>::const_iterator{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-typename vector<T>::iterator vector<T>::begin(){    
+template<typename T, typename Alloc>
+typename vector<T, Alloc>::iterator vector<T, Alloc>::begin(){    
     return iterator(data);
 };
 
@@ -411,8 +598,8 @@ typename vector<T>::iterator vector<T>::begin(){
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-typename vector<T>::iterator vector<T>::end(){
+template<typename T, typename Alloc>
+typename vector<T, Alloc>::iterator vector<T, Alloc>::end(){
     return iterator(data + size);
 }
 
@@ -423,8 +610,8 @@ typename vector<T>::iterator vector<T>::end(){
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-typename vector<T>::const_iterator vector<T>::begin() const{
+template<typename T, typename Alloc>
+typename vector<T, Alloc>::const_iterator vector<T, Alloc>::begin() const{
     return const_iterator(data);
 }
 
@@ -435,23 +622,88 @@ typename vector<T>::const_iterator vector<T>::begin() const{
  * 
  * @note the time complexity is O(1)
  */
-template<typename T>
-typename vector<T>::const_iterator vector<T>::end() const{
+template<typename T, typename Alloc>
+typename vector<T, Alloc>::const_iterator vector<T, Alloc>::end() const{
     return const_iterator(data + size);
 }
 
-template<typename T>
-void vector<T>::clean_up(){
-    delete[] data;
+/**
+ * @brief Reallocates the storage to hold at least min_capacity elements, doubling the capacity when that is larger.
+ * The caller must hold mtx_.
+ *
+ * Trivially copyable elements are handed to Alloc::reallocate when the allocator has one, which lets it grow the
+ * storage in place (e.g. with mremap) instead of copying it.
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::grow(size_t min_capacity){
+    size_t new_capacity = (capacity == 0) ? 1 : capacity * 2;
+    if(new_capacity < min_capacity) new_capacity = min_capacity;
+
+    if constexpr(std::is_trivially_copyable<T>::value && requires(Alloc& a, T* p){ a.reallocate(p, size_t(), size_t()); }){
+        if(data){
+            data = alloc.reallocate(data, capacity, new_capacity);
+            std::uninitialized_default_construct(data + capacity, data + new_capacity);
+            capacity = new_capacity;
+            return;
+        }
+    }
+
+    T* data_restore = allocate_storage(new_capacity);
+
+    for(size_t i = 0; i < size; ++i) data_restore[i] = std::move(data[i]);
+
+    free_storage(data, capacity);
+    data = data_restore;
+    capacity = new_capacity;
+};
+
+/**
+ * @brief Appends an element without locking. The caller must hold mtx_.
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::push_back_unlocked(const T& el){
+    if(size == capacity) grow(size + 1);
+    data[size] = el;
+    ++size;
+};
+
+template<typename T, typename Alloc>
+void vector<T, Alloc>::clean_up(){
+    free_storage(data, capacity);
     data = nullptr;
     size = capacity = 0;
 };
 
-template<typename T>
-void vector<T>::copy_from(const vector<T>& v){
+/**
+ * @brief Allocates storage for n elements through Alloc and default-constructs them.
+ */
+template<typename T, typename Alloc>
+T* vector<T, Alloc>::allocate_storage(size_t n){
+    T* p = alloc.allocate(n);
+    try{
+        std::uninitialized_default_construct(p, p + n);
+    }catch(...){
+        alloc.deallocate(p, n);
+        throw;
+    }
+    return p;
+};
+
+/**
+ * @brief Destroys the n elements of p and gives the storage back to Alloc.
+ */
+template<typename T, typename Alloc>
+void vector<T, Alloc>::free_storage(T* p, size_t n){
+    if(!p) return;
+    std::destroy(p, p + n);
+    alloc.deallocate(p, n);
+};
+
+template<typename T, typename Alloc>
+void vector<T, Alloc>::copy_from(const vector<T, Alloc>& v){
     size = v.size;
     capacity = v.capacity;
-    data = new T[capacity];
+    data = allocate_storage(capacity);
     for(size_t i = 0; i < v.size; ++i) data[i] = v.data[i];
 };
 
@@ -467,3 +719,4 @@ void vector<T>::copy_from(const vector<T>& v){
 
     
 
+#endif
@@ -3,6 +3,13 @@
 #include <ostream>
 #include <stdexcept>
 #include <mutex>
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <type_traits>
+#include <memory>
+#include "../allocators/allocator.hpp"
+#include "snapshot_header.hpp"
 
 /**
  * @file vector.hpp
@@ -10,40 +17,55 @@
  *
  * This vector class is a handcrafted implementation designed to emulate the behavior and functionalities of the STL vector in C++. It provides dynamic array capabilities and is designed to be versatile across multiple data types. The implementation ensures thread safety through mutexes and lock guards, allowing for concurrent access and modifications without data races or inconsistencies.
  *
+ * The storage is obtained from Alloc (the project allocator by default), e.g. huge_page_allocator for very large
+ * vectors.
+ *
  * @note For utilizing the functionalities of this vector class, it's imperative to include this file.
  * 
  * @author Andrea Maggetto
  */
 
-template<typename T>
+template<typename T, typename Alloc = allocator<T>>
 class vector{
-    T* data;
+    Alloc alloc;
     size_t size, capacity;
+    T* data;
     mutable std::mutex mtx_;
 
+    T* allocate_storage(size_t n);
+    void free_storage(T* p, size_t n);
+
     void clean_up();
-    void copy_from(const vector<T>& v);
+    void copy_from(const vector& v);
+    void grow(size_t min_capacity);
+    void push_back_unlocked(const T& el);
 
     public:
         class iterator;
         class const_iterator;
+        class batch;
 
         vector();
+        explicit vector(const Alloc& a);
         vector(const T& init, size_t init_size);
-        vector(const vector<T>& v);
-        vector(vector<T>&& v);
+        vector(const vector& v);
+        vector(vector&& v);
         ~vector();  
 
-        vector<T>& operator=(const vector<T>& v);
-        vector<T>& operator=(vector<T>&& v) noexcept;
+        vector& operator=(const vector& v);
+        vector& operator=(vector&& v) noexcept;
         const T& operator[](const size_t index) const;
         T& operator[](const size_t index);
         
-        bool operator==(const vector<T>& v) const;
-        bool operator!=(const vector<T>& v) const;
+        bool operator==(const vector& v) const;
+        bool operator!=(const vector& v) const;
 
         size_t get_size() const;
         void push_back(const T& el);
+        template<typename InputIt>
+        void push_back_n(InputIt first, size_t n);
+        batch lock_batch();
+        void pop_back();
         T& at(const size_t index) const;
         bool empty() const;
         T& back() const;
@@ -53,6 +75,9 @@ class vector{
         iterator end();
         const_iterator begin() const;
         const_iterator end() const;
+
+        void save(const std::string& path) const;
+        void load(const std::string& path);
 };
 
 #endif
@@ -0,0 +1,463 @@
+#ifndef VECTOR_SORT_CPP
+#define VECTOR_SORT_CPP
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include "vector_sort.hpp"
+
+/*
+    @file vector_sort.cpp
+    @brief The current cpp source file contains the actual implementation of the sorting algorithms.
+    Definitions are given in this file since they are templates.
+*/
+
+namespace sort_detail{
+    constexpr size_t insertion_threshold = 24;
+    constexpr size_t ninther_threshold = 128;
+    constexpr size_t partial_insertion_limit = 8;
+    constexpr size_t network_size = 16;
+    constexpr size_t radix_threshold = 256;
+    constexpr size_t parallel_threshold = size_t(1) << 16;
+
+    template<typename T, typename Compare>
+    constexpr bool uses_network = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+                                  std::is_same<Compare, std::less<T>>::value;
+
+    /**
+     * @brief Maps a key to an unsigned integer with the same order, so that it can be radix sorted.
+     */
+    template<typename T>
+    auto radix_key(T value){
+        if constexpr(std::is_floating_point<T>::value){
+            using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            const U bits = std::bit_cast<U>(value);
+            const U sign = U(1) << (sizeof(U) * 8 - 1);
+            return (bits & sign) ? U(~bits) : U(bits | sign);
+        }
+        else{
+            using U = std::make_unsigned_t<T>;
+            U bits = static_cast<U>(value);
+            if constexpr(std::is_signed<T>::value) bits ^= U(1) << (sizeof(U) * 8 - 1);
+            return bits;
+        }
+    }
+
+    template<typename T, typename Compare>
+    void insertion_sort(T* begin, T* end, Compare& comp){
+        if(begin == end) return;
+        for(T* cur = begin + 1; cur != end; ++cur){
+            if(!comp(*cur, *(cur - 1))) continue;
+            T tmp = std::move(*cur);
+            T* sift = cur;
+            do{
+                *sift = std::move(*(sift - 1));
+                --sift;
+            }while(sift != begin && comp(tmp, *(sift - 1)));
+            *sift = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Insertion sort relying on *(begin - 1) being no greater than any element of the range.
+     */
+    template<typename T, typename Compare>
+    void unguarded_insertion_sort(T* begin, T* end, Compare& comp){
+        if(begin == end) return;
+        for(T* cur = begin + 1; cur != end; ++cur){
+            if(!comp(*cur, *(cur - 1))) continue;
+            T tmp = std::move(*cur);
+            T* sift = cur;
+            do{
+                *sift = std::move(*(sift - 1));
+                --sift;
+            }while(comp(tmp, *(sift - 1)));
+            *sift = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Insertion sort giving up after partial_insertion_limit moved elements.
+     * @return true if the range got sorted.
+     */
+    template<typename T, typename Compare>
+    bool partial_insertion_sort(T* begin, T* end, Compare& comp){
+        if(begin == end) return true;
+        size_t moves = 0;
+        for(T* cur = begin + 1; cur != end; ++cur){
+            if(!comp(*cur, *(cur - 1))) continue;
+            T tmp = std::move(*cur);
+            T* sift = cur;
+            do{
+                *sift = std::move(*(sift - 1));
+                --sift;
+            }while(sift != begin && comp(tmp, *(sift - 1)));
+            *sift = std::move(tmp);
+
+            moves += cur - sift;
+            if(moves > partial_insertion_limit) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Sorts up to network_size arithmetic keys with Batcher's odd-even merge network.
+     *
+     * The keys are padded to network_size with the largest value and every comparator is a min/max pair, so
+     * the network has no data dependent branch and the compiler maps it to vector min/max instructions.
+     */
+    template<typename T>
+    void network_sort(T* begin, size_t n){
+        T keys[network_size];
+        const T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+        for(size_t i = 0; i < n; ++i) keys[i] = begin[i];
+        for(size_t i = n; i < network_size; ++i) keys[i] = pad;
+
+        for(size_t p = 1; p < network_size; p <<= 1){
+            for(size_t k = p; k >= 1; k >>= 1){
+                for(size_t j = k % p; j + k < network_size; j += 2 * k){
+                    for(size_t i = 0; i < k && i + j + k < network_size; ++i){
+                        if((i + j) / (2 * p) != (i + j + k) / (2 * p)) continue;
+                        const T a = keys[i + j];
+                        const T b = keys[i + j + k];
+                        keys[i + j] = b < a ? b : a;
+                        keys[i + j + k] = b < a ? a : b;
+                    }
+                }
+            }
+        }
+
+        for(size_t i = 0; i < n; ++i) begin[i] = keys[i];
+    }
+
+    template<typename T, typename Compare>
+    void sort2(T* a, T* b, Compare& comp){
+        if(comp(*b, *a)) std::iter_swap(a, b);
+    }
+
+    template<typename T, typename Compare>
+    void sort3(T* a, T* b, T* c, Compare& comp){
+        sort2(a, b, comp);
+        sort2(b, c, comp);
+        sort2(a, b, comp);
+    }
+
+    /**
+     * @brief Partitions [begin, end) around the pivot *begin, elements equal to it going right.
+     * @return The final position of the pivot, and whether the range was already partitioned.
+     */
+    template<typename T, typename Compare>
+    std::pair<T*, bool> partition_right(T* begin, T* end, Compare& comp){
+        T pivot = std::move(*begin);
+        T* first = begin;
+        T* last = end;
+
+        while(comp(*++first, pivot));
+        if(first - 1 == begin){
+            while(first < last && !comp(*--last, pivot));
+        }
+        else{
+            while(!comp(*--last, pivot));
+        }
+
+        const bool already_partitioned = first >= last;
+        while(first < last){
+            std::iter_swap(first, last);
+            while(comp(*++first, pivot));
+            while(!comp(*--last, pivot));
+        }
+
+        T* pivot_pos = first - 1;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return {pivot_pos, already_partitioned};
+    }
+
+    /**
+     * @brief Partitions [begin, end) around the pivot *begin, elements equal to it going left. Used when the pivot
+     * equals the previous one, so that runs of equal keys are finished in one pass.
+     */
+    template<typename T, typename Compare>
+    T* partition_left(T* begin, T* end, Compare& comp){
+        T pivot = std::move(*begin);
+        T* first = begin;
+        T* last = end;
+
+        while(comp(pivot, *--last));
+        if(last + 1 == end){
+            while(first < last && !comp(pivot, *++first));
+        }
+        else{
+            while(!comp(pivot, *++first));
+        }
+
+        while(first < last){
+            std::iter_swap(first, last);
+            while(comp(pivot, *--last));
+            while(!comp(pivot, *++first));
+        }
+
+        T* pivot_pos = last;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return pivot_pos;
+    }
+
+    template<typename T, typename Compare>
+    void finish_small(T* begin, T* end, Compare& comp, bool leftmost){
+        if constexpr(uses_network<T, Compare>){
+            if(size_t(end - begin) <= network_size){
+                network_sort(begin, end - begin);
+                return;
+            }
+        }
+        if(leftmost) insertion_sort(begin, end, comp);
+        else unguarded_insertion_sort(begin, end, comp);
+    }
+
+    template<typename T, typename Compare>
+    void introsort_loop(T* begin, T* end, Compare& comp, int bad_allowed, bool leftmost){
+        while(true){
+            const size_t size = end - begin;
+            if(size < insertion_threshold){
+                finish_small(begin, end, comp, leftmost);
+                return;
+            }
+
+            const size_t half = size / 2;
+            if(size > ninther_threshold){
+                sort3(begin, begin + half, end - 1, comp);
+                sort3(begin + 1, begin + (half - 1), end - 2, comp);
+                sort3(begin + 2, begin + (half + 1), end - 3, comp);
+                sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+                std::iter_swap(begin, begin + half);
+            }
+            else{
+                sort3(begin + half, begin, end - 1, comp);
+            }
+
+            if(!leftmost && !comp(*(begin - 1), *begin)){
+                begin = partition_left(begin, end, comp) + 1;
+                continue;
+            }
+
+            const std::pair<T*, bool> part = partition_right(begin, end, comp);
+            T* pivot_pos = part.first;
+            const size_t l = pivot_pos - begin;
+            const size_t r = end - (pivot_pos + 1);
+
+            if(l < size / 8 || r < size / 8){
+                if(--bad_allowed == 0){
+                    std::make_heap(begin, end, comp);
+                    std::sort_heap(begin, end, comp);
+                    return;
+                }
+                if(l >= insertion_threshold){
+                    std::iter_swap(begin, begin + l / 4);
+                    std::iter_swap(pivot_pos - 1, pivot_pos - l / 4);
+                }
+                if(r >= insertion_threshold){
+                    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r / 4));
+                    std::iter_swap(end - 1, end - r / 4);
+                }
+            }
+            else if(part.second && partial_insertion_sort(begin, pivot_pos, comp) && partial_insertion_sort(pivot_pos + 1, end, comp)){
+                return;
+            }
+
+            if(l < r){
+                introsort_loop(begin, pivot_pos, comp, bad_allowed, leftmost);
+                begin = pivot_pos + 1;
+                leftmost = false;
+            }
+            else{
+                introsort_loop(pivot_pos + 1, end, comp, bad_allowed, false);
+                end = pivot_pos;
+            }
+        }
+    }
+
+    /**
+     * @brief Merges the sorted ranges a and b into out, splitting the work across the group when it is large.
+     *
+     * The larger range is cut at its middle and the other one at the matching lower bound, which gives two
+     * independent merges writing to disjoint parts of out.
+     */
+    template<typename T, typename Compare>
+    void parallel_merge(T* a, size_t na, T* b, size_t nb, T* out, Compare& comp, task_scheduler::task_group& g){
+        if(na + nb <= parallel_threshold){
+            std::merge(std::make_move_iterator(a), std::make_move_iterator(a + na),
+                       std::make_move_iterator(b), std::make_move_iterator(b + nb), out, comp);
+            return;
+        }
+        if(na < nb){
+            std::swap(a, b);
+            std::swap(na, nb);
+        }
+
+        const size_t ma = na / 2;
+        const size_t mb = std::lower_bound(b, b + nb, a[ma], comp) - b;
+        g.run([=, &comp, &g]{ parallel_merge(a, ma, b, mb, out, comp, g); });
+        parallel_merge(a + ma, na - ma, b + mb, nb - mb, out + ma + mb, comp, g);
+    }
+}
+
+/**
+ * @brief Sorts [first, first + n) in ascending order with an LSD radix sort on 8 bit digits.
+ *
+ * Floating point keys are ordered like operator< (negative zero before zero, NaNs after infinity or before
+ * negative infinity depending on their sign).
+ *
+ * @param first Pointer to the first key.
+ * @param n The number of keys.
+ *
+ * @note the time complexity is O(n * sizeof(T)), with n extra elements of memory
+ */
+template<typename T>
+void radix_sort(T* first, size_t n){
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "radix_sort requires integral or floating point keys");
+    if(n < sort_detail::radix_threshold){
+        introsort(first, n);
+        return;
+    }
+
+    constexpr size_t digits = sizeof(T);
+    std::unique_ptr<size_t[]> counts(new size_t[digits * 256]());
+    for(size_t i = 0; i < n; ++i){
+        auto key = sort_detail::radix_key(first[i]);
+        for(size_t d = 0; d < digits; ++d, key >>= 8) ++counts[d * 256 + (key & 0xFF)];
+    }
+
+    std::unique_ptr<T[]> buffer(new T[n]);
+    T* src = first;
+    T* dst = buffer.get();
+
+    for(size_t d = 0; d < digits; ++d){
+        size_t* count = counts.get() + d * 256;
+        const size_t shift = d * 8;
+        if(count[(sort_detail::radix_key(src[0]) >> shift) & 0xFF] == n) continue;
+
+        size_t offset = 0;
+        for(size_t b = 0; b < 256; ++b){
+            const size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for(size_t i = 0; i < n; ++i) dst[count[(sort_detail::radix_key(src[i]) >> shift) & 0xFF]++] = src[i];
+        std::swap(src, dst);
+    }
+
+    if(src != first) std::memcpy(first, src, n * sizeof(T));
+};
+
+/**
+ * @brief Sorts [first, first + n) with pattern-defeating introsort. It is not stable.
+ *
+ * @param first Pointer to the first element.
+ * @param n The number of elements.
+ * @param comp The strict weak ordering.
+ *
+ * @note the time complexity is O(n log n) in the worst case, O(n) on sorted, reversed or few-unique inputs
+ */
+template<typename T, typename Compare>
+void introsort(T* first, size_t n, Compare comp){
+    if(n < 2) return;
+    sort_detail::introsort_loop(first, first + n, comp, std::bit_width(n), true);
+};
+
+/**
+ * @brief Sorts [first, first + n) on the workers of s: one introsort per chunk, then parallel merge rounds.
+ *
+ * @param first Pointer to the first element.
+ * @param n The number of elements.
+ * @param s The scheduler providing the threads.
+ * @param comp The strict weak ordering.
+ *
+ * @note the time complexity is O(n log n / workers + n) with n extra elements of memory
+ */
+template<typename T, typename Compare>
+void parallel_sort(T* first, size_t n, task_scheduler& s, Compare comp){
+    const size_t workers = s.get_workers();
+    if(n <= sort_detail::parallel_threshold || workers < 2){
+        introsort(first, n, comp);
+        return;
+    }
+
+    size_t chunks = std::bit_ceil(workers);
+    while(chunks > 1 && n / chunks < sort_detail::parallel_threshold / 4) chunks /= 2;
+
+    std::unique_ptr<size_t[]> bounds(new size_t[chunks + 1]);
+    for(size_t c = 0; c <= chunks; ++c) bounds[c] = n / chunks * c;
+    bounds[chunks] = n;
+
+    task_scheduler::task_group g(s);
+    for(size_t c = 0; c < chunks; ++c){
+        g.run([first, lo = bounds[c], hi = bounds[c + 1], &comp]{ introsort(first + lo, hi - lo, comp); });
+    }
+    g.wait();
+
+    std::unique_ptr<T[]> buffer(new T[n]);
+    T* src = first;
+    T* dst = buffer.get();
+    for(size_t width = 1; width < chunks; width *= 2){
+        for(size_t c = 0; c < chunks; c += 2 * width){
+            const size_t lo = bounds[c];
+            const size_t mid = bounds[c + width];
+            const size_t hi = bounds[std::min(c + 2 * width, chunks)];
+            g.run([=, &comp, &g]{ sort_detail::parallel_merge(src + lo, mid - lo, src + mid, hi - mid, dst + lo, comp, g); });
+        }
+        g.wait();
+        std::swap(src, dst);
+    }
+
+    if(src != first) std::move(src, src + n, first);
+};
+
+/**
+ * @brief Sorts a vector of integral or floating point keys in ascending order with radix_sort.
+ *
+ * @note the time complexity is O(n * sizeof(T))
+ */
+template<typename T, typename Alloc>
+void radix_sort(vector<T, Alloc>& v){
+    typename vector<T, Alloc>::batch b = v.lock_batch();
+    if(b.get_size() > 1) radix_sort(&b[0], b.get_size());
+};
+
+/**
+ * @brief Sorts a vector with introsort.
+ *
+ * @note the time complexity is O(n log n)
+ */
+template<typename T, typename Alloc, typename Compare>
+void introsort(vector<T, Alloc>& v, Compare comp){
+    typename vector<T, Alloc>::batch b = v.lock_batch();
+    if(b.get_size() > 1) introsort(&b[0], b.get_size(), comp);
+};
+
+/**
+ * @brief Sorts a vector on the workers of s.
+ *
+ * @note the time complexity is O(n log n / workers + n)
+ */
+template<typename T, typename Alloc, typename Compare>
+void parallel_sort(vector<T, Alloc>& v, task_scheduler& s, Compare comp){
+    typename vector<T, Alloc>::batch b = v.lock_batch();
+    if(b.get_size() > 1) parallel_sort(&b[0], b.get_size(), s, comp);
+};
+
+/**
+ * @brief Sorts a vector, with radix_sort for arithmetic keys in ascending order and introsort otherwise.
+ *
+ * @note the time complexity is O(n * sizeof(T)) for radix sorted keys, O(n log n) otherwise
+ */
+template<typename T, typename Alloc, typename Compare>
+void vector_sort(vector<T, Alloc>& v, Compare comp){
+    if constexpr(sort_detail::uses_network<T, Compare>) radix_sort(v);
+    else introsort(v, comp);
+};
+
+#endif
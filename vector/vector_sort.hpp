@@ -0,0 +1,45 @@
+#ifndef VECTOR_SORT_HPP
+#define VECTOR_SORT_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "vector.cpp"
+#include "../scheduler/task_scheduler.cpp"
+
+/**
+ * @file vector_sort.hpp
+ * @brief Sorting algorithms for vector and for contiguous ranges.
+ *
+ * - radix_sort: LSD radix sort on 8 bit digits for integral and floating point keys. One read builds the
+ *   histograms of every digit, and digits shared by all keys (e.g. the high bytes of small numbers) are skipped.
+ * - introsort: pattern-defeating quicksort. It uses median-of-3 or ninther pivots, detects already partitioned
+ *   ranges, groups keys equal to the previous pivot, and falls back to heapsort after too many unbalanced
+ *   partitions. Small partitions are finished by insertion sort, or by a branchless sorting network for
+ *   arithmetic keys compared with std::less.
+ * - parallel_sort: introsort of one chunk per worker of a task_scheduler, then rounds of merges, each merge
+ *   itself split across the workers by co-ranking.
+ * - vector_sort: picks radix_sort for arithmetic keys in ascending order and introsort otherwise.
+ *
+ * The vector overloads hold the batch lock of the vector for the whole sort.
+ *
+ * @author Andrea Maggetto
+ */
+
+template<typename T>
+void radix_sort(T* first, size_t n);
+template<typename T, typename Compare = std::less<T>>
+void introsort(T* first, size_t n, Compare comp = Compare());
+template<typename T, typename Compare = std::less<T>>
+void parallel_sort(T* first, size_t n, task_scheduler& s, Compare comp = Compare());
+
+template<typename T, typename Alloc>
+void radix_sort(vector<T, Alloc>& v);
+template<typename T, typename Alloc, typename Compare = std::less<T>>
+void introsort(vector<T, Alloc>& v, Compare comp = Compare());
+template<typename T, typename Alloc, typename Compare = std::less<T>>
+void parallel_sort(vector<T, Alloc>& v, task_scheduler& s, Compare comp = Compare());
+template<typename T, typename Alloc, typename Compare = std::less<T>>
+void vector_sort(vector<T, Alloc>& v, Compare comp = Compare());
+
+#endif